@@ -28,6 +28,7 @@
 #include "functions.h"
 #include "misc.h"
 #include "settings.h"
+#include "timer.h"
 #include "ui/inputbox.h"
 #include "ui/ui.h"
 
@@ -66,7 +67,7 @@ static void ACTION_Monitor(void)
 		return;
 	}
 	if (gScanState != SCAN_OFF) {
-		ScanPauseDelayIn10msec = 500;
+		TIMER_Start(TIMER_SCAN_PAUSE, 500);
 		gScheduleScanListen = false;
 		gScanPauseMode = true;
 	}
@@ -36,6 +36,7 @@
 #include "driver/bk1080.h"
 #endif
 #include "driver/bk4819.h"
+#include "driver/eeprom.h"
 #include "driver/gpio.h"
 #include "driver/keyboard.h"
 #include "driver/st7565.h"
@@ -50,6 +51,7 @@
 #include "misc.h"
 #include "radio.h"
 #include "settings.h"
+#include "timer.h"
 #include "ui/battery.h"
 #include "ui/inputbox.h"
 #include "ui/menu.h"
@@ -57,14 +59,47 @@
 #include "ui/status.h"
 #include "ui/ui.h"
 
+// Ticks after a hop before the adaptive dwell first looks at the channel
+#define SCAN_PROBE_DELAY 3U
+
 static uint16_t CurrentRSSI;
 static bool bUpdateRSSI;
+static uint16_t gScanDwell;
+static bool gScanProbe;
+
+static void SCAN_StartDwell(uint16_t Delay)
+{
+#if defined(ENABLE_PERF_STATS)
+	gScanStats.Hops++;
+#endif
+	if (gEeprom.SCAN_ADAPTIVE_DWELL && Delay > SCAN_PROBE_DELAY) {
+		gScanDwell = Delay - SCAN_PROBE_DELAY;
+		gScanProbe = true;
+		Delay = SCAN_PROBE_DELAY;
+	} else {
+		gScanProbe = false;
+	}
+	TIMER_Start(TIMER_SCAN_PAUSE, Delay);
+}
+
+static bool SCAN_IsChannelDead(void)
+{
+	if (gCurrentFunction == FUNCTION_INCOMING) {
+		return false;
+	}
+	// Below the close threshold with noise or glitches also past theirs
+	if (BK4819_GetRSSI() >= gRxVfo->SquelchCloseRSSI) {
+		return false;
+	}
+
+	return BK4819_GetExNoise() > gRxVfo->SquelchCloseNoise || BK4819_GetGlitch() > gRxVfo->SquelchCloseGlitch;
+}
 
 static void APP_CheckForIncoming(void)
 {
 	if (gScanState == SCAN_OFF) {
 		if (gCssScanMode != CSS_SCAN_MODE_OFF && gRxReceptionMode == RX_MODE_NONE) {
-			ScanPauseDelayIn10msec = 100;
+			TIMER_Start(TIMER_SCAN_PAUSE, 100);
 			gScheduleScanListen = false;
 			gRxReceptionMode = RX_MODE_DETECTED;
 		}
@@ -76,15 +111,16 @@ static void APP_CheckForIncoming(void)
 			FUNCTION_Select(FUNCTION_INCOMING);
 			return;
 		}
-		gDualWatchCountdown = 100;
+		TIMER_Start(TIMER_DUAL_WATCH, 100);
 		gScheduleDualWatch = false;
 	} else {
 		if (gRxReceptionMode != RX_MODE_NONE) {
 			FUNCTION_Select(FUNCTION_INCOMING);
 			return;
 		}
-		ScanPauseDelayIn10msec = 20;
+		TIMER_Start(TIMER_SCAN_PAUSE, 20);
 		gScheduleScanListen = false;
+		gScanProbe = false;
 	}
 	gRxReceptionMode = RX_MODE_DETECTED;
 	FUNCTION_Select(FUNCTION_INCOMING);
@@ -103,7 +139,7 @@ static void APP_EndReceive(uint8_t Mode)
 		if (gScanState != SCAN_OFF) {
 			switch (gEeprom.SCAN_RESUME_MODE) {
 			case SCAN_RESUME_CO:
-				ScanPauseDelayIn10msec = 360;
+				TIMER_Start(TIMER_SCAN_PAUSE, 360);
 				gScheduleScanListen = false;
 				break;
 			case SCAN_RESUME_SE:
@@ -117,7 +153,7 @@ static void APP_EndReceive(uint8_t Mode)
 		if (gEeprom.TAIL_NOTE_ELIMINATION) {
 			GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
 			gEnableSpeaker = false;
-			gTailNoteEliminationCountdown = 20;
+			TIMER_Start(TIMER_TAIL_NOTE, 20);
 			gFlagTteComplete = false;
 			gEndOfRxDetectedMaybe = true;
 		}
@@ -174,7 +210,7 @@ static void APP_HandleReceive(void)
 					gFoundCTCSS = false;
 				} else if (!gFoundCTCSS) {
 					gFoundCTCSS = true;
-					gFoundCTCSSCountdown = 100;
+					TIMER_Start(TIMER_FOUND_CTCSS, 100);
 				}
 				if (g_CxCSS_TAIL_Found) {
 					Mode = END_OF_RX_MODE_TTE;
@@ -188,7 +224,7 @@ static void APP_HandleReceive(void)
 					gFoundCDCSS = false;
 				} else if (!gFoundCDCSS) {
 					gFoundCDCSS = true;
-					gFoundCDCSSCountdown = 100;
+					TIMER_Start(TIMER_FOUND_CDCSS, 100);
 				}
 				if (g_CxCSS_TAIL_Found) {
 					if (BK4819_GetCTCType() == 1) {
@@ -257,7 +293,7 @@ static void APP_HandleFunction(void)
 			if (gRxVfo->DTMF_DECODING_ENABLE) {
 				if (gDTMF_CallState == DTMF_CALL_STATE_NONE) {
 					if (gRxReceptionMode == RX_MODE_DETECTED) {
-						gDualWatchCountdown = 500;
+						TIMER_Start(TIMER_DUAL_WATCH, 500);
 						gScheduleDualWatch = false;
 						gRxReceptionMode = RX_MODE_LISTENING;
 					}
@@ -290,17 +326,18 @@ void APP_StartListening(FUNCTION_Type_t Function)
 	BACKLIGHT_TurnOn();
 
 	if (gScanState != SCAN_OFF) {
+		gScanProbe = false;
 		switch (gEeprom.SCAN_RESUME_MODE) {
 		case SCAN_RESUME_TO:
 			if (!gScanPauseMode) {
-				ScanPauseDelayIn10msec = 500;
+				TIMER_Start(TIMER_SCAN_PAUSE, 500);
 				gScheduleScanListen = false;
 				gScanPauseMode = true;
 			}
 			break;
 		case SCAN_RESUME_CO:
 		case SCAN_RESUME_SE:
-			ScanPauseDelayIn10msec = 0;
+			TIMER_Stop(TIMER_SCAN_PAUSE);
 			gScheduleScanListen = false;
 			break;
 		}
@@ -311,7 +348,7 @@ void APP_StartListening(FUNCTION_Type_t Function)
 	}
 	if (gScanState == SCAN_OFF && gCssScanMode == CSS_SCAN_MODE_OFF && gEeprom.DUAL_WATCH != DUAL_WATCH_OFF) {
 		gRxVfoIsActive = true;
-		gDualWatchCountdown = 360;
+		TIMER_Start(TIMER_DUAL_WATCH, 360);
 		gScheduleDualWatch = false;
 	}
 
@@ -366,7 +403,7 @@ static void FREQ_NextChannel(void)
 	RADIO_ConfigureSquelchAndOutputPower(gRxVfo);
 	RADIO_SetupRegisters(true);
 	gUpdateDisplay = true;
-	ScanPauseDelayIn10msec = 10;
+	SCAN_StartDwell(10);
 	bScanKeepFrequency = false;
 }
 
@@ -418,7 +455,7 @@ static void MR_NextChannel(void)
 		RADIO_SetupRegisters(true);
 		gUpdateDisplay = true;
 	}
-	ScanPauseDelayIn10msec = 20;
+	SCAN_StartDwell(20);
 	bScanKeepFrequency = false;
 	if (bEnabled) {
 		gCurrentScanList++;
@@ -434,7 +471,7 @@ static void DUALWATCH_Alternate(void)
 	gRxVfo = &gVFO.Info[gEeprom.RX_VFO];
 
 	RADIO_SetupRegisters(false);
-	gDualWatchCountdown = 10;
+	TIMER_Start(TIMER_DUAL_WATCH, 10);
 }
 
 void APP_EndTransmission(void)
@@ -452,6 +489,7 @@ void APP_Update(void)
 		UART_HandleCommand();
 		__enable_irq();
 	}
+	UART_HandlePending();
 #endif
 
     gFlashLightBlinkCounter++;
@@ -481,6 +519,19 @@ void APP_Update(void)
 		APP_HandleFunction();
 	}
 
+	if (gScreenToDisplay != DISPLAY_SCANNER && gScanState != SCAN_OFF && gScheduleScanListen && !gPttIsPressed && gScanProbe) {
+		// Hop straight away from a dead channel, otherwise sit out the full window
+		gScanProbe = false;
+		if (SCAN_IsChannelDead()) {
+#if defined(ENABLE_PERF_STATS)
+			gScanStats.EarlyHops++;
+#endif
+		} else {
+			TIMER_Start(TIMER_SCAN_PAUSE, gScanDwell);
+			gScheduleScanListen = false;
+		}
+	}
+
 	if (gScreenToDisplay != DISPLAY_SCANNER && gScanState != SCAN_OFF && gScheduleScanListen && !gPttIsPressed) {
 		if (IS_FREQ_CHANNEL(gNextMrChannel)) {
 			if (gCurrentFunction == FUNCTION_INCOMING) {
@@ -505,7 +556,11 @@ void APP_Update(void)
 		gScheduleScanListen = false;
 	}
 
-	if (gScreenToDisplay != DISPLAY_SCANNER && gEeprom.DUAL_WATCH != DUAL_WATCH_OFF) {
+	if (gScreenToDisplay != DISPLAY_SCANNER
+#if defined(ENABLE_SPECTRUM)
+			&& gScreenToDisplay != DISPLAY_SPECTRUM
+#endif
+			&& gEeprom.DUAL_WATCH != DUAL_WATCH_OFF) {
 		if (gScheduleDualWatch) {
 			if (gScanState == SCAN_OFF && gCssScanMode == CSS_SCAN_MODE_OFF) {
 				if (!gPttIsPressed
@@ -535,7 +590,7 @@ void APP_Update(void)
 				|| gPttIsPressed || gScreenToDisplay != DISPLAY_MAIN || gKeyBeingHeld
 				|| gDTMF_CallState != DTMF_CALL_STATE_NONE
 				) {
-			gBatterySaveCountdown = 1000;
+			TIMER_Start(TIMER_POWER_SAVE, 1000);
 		} else if (gRxVfo->MODULATION_MODE != MOD_DIG) {
 			// Digital modulation cannot go into power save
 			// This is due to the low turnaround needed
@@ -553,12 +608,12 @@ void APP_Update(void)
 				bUpdateRSSI = false;
 			}
 			FUNCTION_Init();
-			gBatterySave = 10;
+			TIMER_Start(TIMER_BATTERY_SAVE, 10);
 			gRxIdleMode = false;
 		} else if (gEeprom.DUAL_WATCH == DUAL_WATCH_OFF || gScanState != SCAN_OFF || gCssScanMode != CSS_SCAN_MODE_OFF || bUpdateRSSI) {
 			CurrentRSSI = BK4819_GetRSSI();
 			UI_UpdateRSSI(CurrentRSSI);
-			gBatterySave = 40;
+			TIMER_Start(TIMER_BATTERY_SAVE, 40);
 			gRxIdleMode = true;
 
 			BK4819_Sleep();
@@ -567,7 +622,7 @@ void APP_Update(void)
 		} else {
 			DUALWATCH_Alternate();
 			bUpdateRSSI = true;
-			gBatterySave = 10;
+			TIMER_Start(TIMER_BATTERY_SAVE, 10);
 		}
 		gBatterySaveCountdownExpired = false;
 	}
@@ -609,7 +664,11 @@ void APP_TimeSlice500ms(void)
 					GPIO_ClearBit(&GPIOB->DATA, GPIOB_PIN_BACKLIGHT);
 				}
 			}
-			if (gScreenToDisplay != DISPLAY_SCANNER || (gScanCssState >= SCAN_CSS_STATE_FOUND)) {
+			if ((gScreenToDisplay != DISPLAY_SCANNER || (gScanCssState >= SCAN_CSS_STATE_FOUND))
+#if defined(ENABLE_SPECTRUM)
+					&& gScreenToDisplay != DISPLAY_SPECTRUM
+#endif
+					) {
 				if (gEeprom.AUTO_KEYPAD_LOCK && gKeyLockCountdown > 0 && !gDTMF_InputMode) {
 					gKeyLockCountdown--;
 					if (gKeyLockCountdown == 0) {
@@ -730,6 +789,17 @@ void APP_TimeSlice500ms(void)
 		}
 	}
 #endif
+
+	// Commit deferred settings once the radio is idle
+	if (EEPROM_HasPending() &&
+		(gCurrentFunction == FUNCTION_FOREGROUND || gCurrentFunction == FUNCTION_POWER_SAVE) &&
+		gScanState == SCAN_OFF &&
+#if defined(ENABLE_FMRADIO)
+		gFM_ScanState == FM_SCAN_OFF &&
+#endif
+		gCssScanMode == CSS_SCAN_MODE_OFF) {
+		EEPROM_Flush();
+	}
 }
 
 void CHANNEL_Next(bool bBackup, int8_t Direction)
@@ -749,7 +819,7 @@ void CHANNEL_Next(bool bBackup, int8_t Direction)
 		}
 		FREQ_NextChannel();
 	}
-	ScanPauseDelayIn10msec = 50;
+	TIMER_Start(TIMER_SCAN_PAUSE, 50);
 	gScheduleScanListen = false;
 	gRxReceptionMode = RX_MODE_NONE;
 	gScanPauseMode = false;
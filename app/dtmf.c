@@ -25,7 +25,7 @@
 #include "driver/gpio.h"
 #include "driver/system.h"
 #include "dtmf.h"
-#include "external/printf/printf.h"
+#include "helper/format.h"
 #include "misc.h"
 #include "settings.h"
 #include "ui/ui.h"
@@ -193,7 +193,7 @@ void DTMF_HandleRequest(void)
 
 	if (gDTMF_WriteIndex >= 9) {
 		Offset = gDTMF_WriteIndex - 9;
-		sprintf(String, "%s%c", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE);
+		FORMAT_Char(FORMAT_String(String, gEeprom.ANI_DTMF_ID), gEeprom.DTMF_SEPARATE_CODE);
 		if (DTMF_CompareMessage(gDTMF_Received + Offset, String, 9, true)) {
 			gDTMF_ReplyState = DTMF_REPLY_NONE;
 			gDTMF_CallState = DTMF_CALL_STATE_NONE;
@@ -201,7 +201,7 @@ void DTMF_HandleRequest(void)
 			gUpdateStatus = true;
 			return;
 		}
-		sprintf(String, "%s%c", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE);
+		FORMAT_Char(FORMAT_String(String, gEeprom.ANI_DTMF_ID), gEeprom.DTMF_SEPARATE_CODE);
 		if (DTMF_CompareMessage(gDTMF_Received + Offset, String, 9, true)) {
 			gDTMF_ReplyState = DTMF_REPLY_AB;
 			gDTMF_CallState = DTMF_CALL_STATE_NONE;
@@ -221,7 +221,7 @@ void DTMF_HandleRequest(void)
 
 	if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT && gDTMF_CallMode == DTMF_CALL_MODE_NOT_GROUP && gDTMF_WriteIndex >= 9) {
 		Offset = gDTMF_WriteIndex - 9;
-		sprintf(String, "%s%c%s", gDTMF_String, gEeprom.DTMF_SEPARATE_CODE, "AAAAA");
+		FORMAT_String(FORMAT_Char(FORMAT_String(String, gDTMF_String), gEeprom.DTMF_SEPARATE_CODE), "AAAAA");
 		if (DTMF_CompareMessage(gDTMF_Received + Offset, String, 9, false)) {
 			gDTMF_State = DTMF_STATE_CALL_OUT_RSP;
 			gUpdateDisplay = true;
@@ -234,7 +234,7 @@ void DTMF_HandleRequest(void)
 
 	if (gDTMF_WriteIndex >= 7) {
 		Offset = gDTMF_WriteIndex - 7;
-		sprintf(String, "%s%c", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE);
+		FORMAT_Char(FORMAT_String(String, gEeprom.ANI_DTMF_ID), gEeprom.DTMF_SEPARATE_CODE);
 		gDTMF_IsGroupCall = false;
 		if (DTMF_CompareMessage(gDTMF_Received + Offset, String, 4, true)) {
 			gDTMF_CallState = DTMF_CALL_STATE_RECEIVED;
@@ -279,7 +279,7 @@ void DTMF_Reply(void)
 		if (gDTMF_CallMode == DTMF_CALL_MODE_DTMF) {
 			pString = gDTMF_String;
 		} else {
-			sprintf(String, "%s%c%s", gDTMF_String, gEeprom.DTMF_SEPARATE_CODE, gEeprom.ANI_DTMF_ID);
+			FORMAT_String(FORMAT_Char(FORMAT_String(String, gDTMF_String), gEeprom.DTMF_SEPARATE_CODE), gEeprom.ANI_DTMF_ID);
 			pString = String;
 		}
 		break;
@@ -289,7 +289,7 @@ void DTMF_Reply(void)
 		break;
 
 	case DTMF_REPLY_AAAAA:
-		sprintf(String, "%s%c%s", gEeprom.ANI_DTMF_ID, gEeprom.DTMF_SEPARATE_CODE, "AAAAA");
+		FORMAT_String(FORMAT_Char(FORMAT_String(String, gEeprom.ANI_DTMF_ID), gEeprom.DTMF_SEPARATE_CODE), "AAAAA");
 		pString = String;
 		break;
 
@@ -14,6 +14,7 @@
  *     limitations under the License.
  */
 
+#include <string.h>
 #include "app/app.h"
 #if defined(ENABLE_FMRADIO)
 #include "app/fm.h"
@@ -21,9 +22,11 @@
 #include "app/generic.h"
 #include "app/menu.h"
 #include "app/scanner.h"
+#if defined(ENABLE_SPECTRUM)
+#include "app/spectrum.h"
+#endif
 #include "driver/keyboard.h"
 #include "dtmf.h"
-#include "external/printf/printf.h"
 #include "functions.h"
 #include "misc.h"
 #include "settings.h"
@@ -107,6 +110,14 @@ void GENERIC_Key_PTT(bool bKeyPressed)
 	if (1) {
 #endif
 		if (gCssScanMode == CSS_SCAN_MODE_OFF) {
+#if defined(ENABLE_SPECTRUM)
+			if (gScreenToDisplay == DISPLAY_SPECTRUM) {
+				SPECTRUM_Stop();
+				gPttIsPressed = false;
+				gPttDebounceCounter = 0;
+				return;
+			}
+#endif
 			if (gScreenToDisplay == DISPLAY_MENU
 #if defined(ENABLE_FMRADIO)
 				|| gScreenToDisplay == DISPLAY_FM
@@ -135,7 +146,7 @@ void GENERIC_Key_PTT(bool bKeyPressed)
 						} else {
 							gDTMF_CallMode = DTMF_CALL_MODE_DTMF;
 						}
-						sprintf(gDTMF_String, "%s", gDTMF_InputBox);
+						strcpy(gDTMF_String, gDTMF_InputBox);
 						gDTMF_PreviousIndex = gDTMF_InputIndex;
 						gDTMF_ReplyState = DTMF_REPLY_ANI;
 						gDTMF_State = DTMF_STATE_0;
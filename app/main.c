@@ -23,6 +23,9 @@
 #include "app/generic.h"
 #include "app/main.h"
 #include "app/scanner.h"
+#if defined(ENABLE_SPECTRUM)
+#include "app/spectrum.h"
+#endif
 #include "dtmf.h"
 #include "frequencies.h"
 #include "misc.h"
@@ -166,6 +169,18 @@ static void MAIN_Key_DIGITS(KEY_Code_t Key)
 		gEeprom.CROSS_BAND_RX_TX = CROSS_BAND_OFF;
 		break;
 
+#if defined(ENABLE_SPECTRUM)
+	case KEY_5:
+#if defined(ENABLE_FMRADIO)
+		if (gFmRadioMode) {
+			break;
+		}
+#endif
+		SPECTRUM_Start();
+		gRequestDisplayScreen = DISPLAY_SPECTRUM;
+		break;
+#endif
+
 	case KEY_6:
 		ACTION_Power();
 		break;
@@ -30,6 +30,7 @@
 #include "helper/battery.h"
 #include "misc.h"
 #include "settings.h"
+#include "timer.h"
 #include "ui/inputbox.h"
 #include "ui/menu.h"
 #include "ui/ui.h"
@@ -40,7 +41,7 @@ void MENU_StartCssScan(int8_t Direction)
 	gMenuScrollDirection = Direction;
 	RADIO_SelectVfos();
 	MENU_SelectNextCode();
-	ScanPauseDelayIn10msec = 50;
+	TIMER_Start(TIMER_SCAN_PAUSE, 50);
 	gScheduleScanListen = false;
 }
 
@@ -93,6 +94,7 @@ bool MENU_GetLimits(uint8_t Cursor, uint16_t *pMin, uint16_t *pMax)
 		break;
 #endif
 	case MENU_BCL: case MENU_AUTOLK:
+	case MENU_SC_ADP:
 	case MENU_S_ADD1: case MENU_S_ADD2:
 	case MENU_STE: case MENU_D_ST:
 	case MENU_D_DCD: case MENU_ROGER:
@@ -297,6 +299,10 @@ void MENU_AcceptSetting(void)
 		gEeprom.SCAN_RESUME_MODE = gSubMenuSelection;
 		break;
 
+	case MENU_SC_ADP:
+		gEeprom.SCAN_ADAPTIVE_DWELL = gSubMenuSelection;
+		break;
+
 	case MENU_MDF:
 		gEeprom.CHANNEL_DISPLAY_MODE = gSubMenuSelection;
 		break;
@@ -468,9 +474,9 @@ void MENU_SelectNextCode(void)
 	RADIO_SetupRegisters(true);
 
 	if (gSelectedCodeType == CODE_TYPE_CONTINUOUS_TONE) {
-		ScanPauseDelayIn10msec = 20;
+		TIMER_Start(TIMER_SCAN_PAUSE, 20);
 	} else {
-		ScanPauseDelayIn10msec = 30;
+		TIMER_Start(TIMER_SCAN_PAUSE, 30);
 	}
 
 	gUpdateDisplay = true;
@@ -588,6 +594,10 @@ void MENU_ShowCurrentSetting(void)
 		gSubMenuSelection = gEeprom.SCAN_RESUME_MODE;
 		break;
 
+	case MENU_SC_ADP:
+		gSubMenuSelection = gEeprom.SCAN_ADAPTIVE_DWELL;
+		break;
+
 	case MENU_MDF:
 		gSubMenuSelection = gEeprom.CHANNEL_DISPLAY_MODE;
 		break;
@@ -843,6 +853,7 @@ static void MENU_Key_MENU(void)
 				UI_DisplayMenu(); // Needed for "WAIT!" string
 				if (gMenuCursor == MENU_RESET) {
 					MENU_AcceptSetting();
+					EEPROM_Flush();
 					NVIC_SystemReset();
 				}
 				gFlagAcceptSetting = true;
@@ -20,6 +20,9 @@
 #include "frequencies.h"
 #include "misc.h"
 #include "radio.h"
+#if defined(ENABLE_PERF_STATS)
+#include "scheduler.h"
+#endif
 #include "settings.h"
 #include "ui/inputbox.h"
 #include "ui/ui.h"
@@ -35,12 +38,16 @@ uint32_t gScanFrequency;
 bool gScanPauseMode;
 SCAN_CssState_t gScanCssState;
 volatile bool gScheduleScanListen = true;
-volatile uint16_t ScanPauseDelayIn10msec;
 uint16_t gScanProgressIndicator;
 uint8_t gScanHitCount;
+uint8_t gScanPollDelay;
 bool gScanUseCssResult;
 int8_t gScanState;
 bool bScanKeepFrequency;
+#if defined(ENABLE_PERF_STATS)
+SCAN_Stats_t gScanStats;
+uint32_t gScanStartUs;
+#endif
 
 static void SCANNER_Key_EXIT(void)
 {
@@ -240,9 +247,14 @@ void SCANNER_Start(void)
 		BK4819_SelectFilter(0xFFFFFFFF);
 		BK4819_EnableFrequencyScan();
 	}
+	RADIO_InvalidateProfile();
 	gScanCssResultCode = 0xFF;
 	gScanCssResultType = 0xFF;
 	gScanHitCount = 0;
+	gScanPollDelay = SCANNER_SETTLE_TICKS;
+#if defined(ENABLE_PERF_STATS)
+	gScanStartUs = SCHEDULER_GetTimeUs();
+#endif
 	gScanUseCssResult = false;
 	gDTMF_RequestPending = false;
 	g_CxCSS_TAIL_Found = false;
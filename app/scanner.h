@@ -20,6 +20,28 @@
 #include "dcs.h"
 #include "driver/keyboard.h"
 
+// Consistent frequency scan results needed before the scanner locks on
+#ifndef SCANNER_HIT_COUNT
+#define SCANNER_HIT_COUNT 3U
+#endif
+// Matching CTCSS scan results needed before the tone is taken
+#ifndef SCANNER_CSS_HIT_COUNT
+#define SCANNER_CSS_HIT_COUNT 3U
+#endif
+// Largest difference between two of those results, in 10 Hz units
+#ifndef SCANNER_HIT_TOLERANCE
+#define SCANNER_HIT_TOLERANCE 100
+#endif
+// 10 ms ticks the BK4819 is left alone after a scan is (re)started
+#ifndef SCANNER_SETTLE_TICKS
+#define SCANNER_SETTLE_TICKS 5U
+#endif
+
+#if defined(ENABLE_PERF_STATS)
+// 100 ms per bucket, the last one also counts anything slower
+#define SCANNER_LATENCY_BUCKETS 8U
+#endif
+
 enum SCAN_CssState_t {
 	SCAN_CSS_STATE_OFF      = 0U,
 	SCAN_CSS_STATE_SCANNING = 1U,
@@ -29,6 +51,15 @@ enum SCAN_CssState_t {
 
 typedef enum SCAN_CssState_t SCAN_CssState_t;
 
+#if defined(ENABLE_PERF_STATS)
+typedef struct {
+	uint32_t Hops;
+	uint32_t EarlyHops;
+	uint16_t LockLatency[SCANNER_LATENCY_BUCKETS];
+	uint16_t CssLatency[SCANNER_LATENCY_BUCKETS];
+} SCAN_Stats_t;
+#endif
+
 enum {
 	SCAN_OFF = 0U,
 };
@@ -44,12 +75,16 @@ extern uint32_t gScanFrequency;
 extern bool gScanPauseMode;
 extern SCAN_CssState_t gScanCssState;
 extern volatile bool gScheduleScanListen;
-extern volatile uint16_t ScanPauseDelayIn10msec;
 extern uint16_t gScanProgressIndicator;
 extern uint8_t gScanHitCount;
+extern uint8_t gScanPollDelay;
 extern bool gScanUseCssResult;
 extern int8_t gScanState;
 extern bool bScanKeepFrequency;
+#if defined(ENABLE_PERF_STATS)
+extern SCAN_Stats_t gScanStats;
+extern uint32_t gScanStartUs;
+#endif
 
 void SCANNER_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
 void SCANNER_Start(void);
@@ -0,0 +1,139 @@
+#include <string.h>
+#include "app/spectrum.h"
+#include "driver/bk4819.h"
+#include "frequencies.h"
+#include "misc.h"
+#include "radio.h"
+#include "scheduler.h"
+#include "settings.h"
+#include "ui/ui.h"
+
+uint32_t gSpectrumCentre;
+uint32_t gSpectrumStart;
+uint8_t gSpectrumStepSetting;
+uint8_t gSpectrumPoints;
+uint8_t gSpectrumIndex;
+uint32_t gSpectrumTunedUs;
+uint32_t gSpectrumSweepUs;
+uint32_t gSpectrumRate;
+uint32_t gSpectrumSweeps;
+uint8_t gSpectrumRssi[SPECTRUM_MAX_POINTS];
+uint8_t gSpectrumPeak[SPECTRUM_MAX_POINTS];
+
+static void SPECTRUM_Restart(void)
+{
+	const uint32_t Span = gSpectrumPoints * StepFrequencyTable[gSpectrumStepSetting];
+	const uint32_t Lower = LowerLimitFrequencyBandTable[0] + (Span / 2);
+	const uint32_t Upper = UpperLimitFrequencyBandTable[6] - (Span / 2);
+
+	if (gSpectrumCentre < Lower) {
+		gSpectrumCentre = Lower;
+	} else if (gSpectrumCentre > Upper) {
+		gSpectrumCentre = Upper;
+	}
+	gSpectrumStart = gSpectrumCentre - (Span / 2);
+
+	memset(gSpectrumRssi, 0, sizeof(gSpectrumRssi));
+	memset(gSpectrumPeak, 0, sizeof(gSpectrumPeak));
+	gSpectrumIndex = 0;
+
+	SPECTRUM_Tune(gSpectrumStart);
+	gSpectrumTunedUs = SCHEDULER_GetTimeUs();
+	gSpectrumSweepUs = gSpectrumTunedUs;
+	gUpdateDisplay = true;
+}
+
+void SPECTRUM_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
+{
+	uint32_t Shift;
+
+	if (!bKeyPressed) {
+		return;
+	}
+	// Only the tuning keys repeat while held
+	if (bKeyHeld && Key != KEY_UP && Key != KEY_DOWN) {
+		return;
+	}
+
+	switch (Key) {
+	case KEY_UP:
+	case KEY_DOWN:
+		Shift = (gSpectrumPoints * StepFrequencyTable[gSpectrumStepSetting]) / 4;
+		if (Key == KEY_UP) {
+			gSpectrumCentre += Shift;
+		} else if (gSpectrumCentre > Shift) {
+			gSpectrumCentre -= Shift;
+		}
+		SPECTRUM_Restart();
+		break;
+	case KEY_1:
+		gSpectrumStepSetting = NUMBER_AddWithWraparound(gSpectrumStepSetting, 1, STEP_1_25kHz, STEP_8_33kHz);
+		SPECTRUM_Restart();
+		break;
+	case KEY_7:
+		gSpectrumStepSetting = NUMBER_AddWithWraparound(gSpectrumStepSetting, -1, STEP_1_25kHz, STEP_8_33kHz);
+		SPECTRUM_Restart();
+		break;
+	case KEY_3:
+		if (gSpectrumPoints < SPECTRUM_MAX_POINTS) {
+			gSpectrumPoints <<= 1;
+			SPECTRUM_Restart();
+		}
+		break;
+	case KEY_9:
+		if (gSpectrumPoints > SPECTRUM_MIN_POINTS) {
+			gSpectrumPoints >>= 1;
+			SPECTRUM_Restart();
+		}
+		break;
+	case KEY_5:
+		memset(gSpectrumPeak, 0, sizeof(gSpectrumPeak));
+		gUpdateDisplay = true;
+		break;
+	case KEY_EXIT:
+		SPECTRUM_Stop();
+		break;
+	default:
+		break;
+	}
+}
+
+void SPECTRUM_Tune(uint32_t Frequency)
+{
+#if defined(ENABLE_FAST_RETUNE)
+	// Neighbouring points are always within PLL lock range
+	if (BK4819_FastRetune(Frequency)) {
+		return;
+	}
+#endif
+	BK4819_SetFrequency(Frequency);
+	BK4819_SelectFilter(Frequency);
+	BK4819_RX_TurnOn();
+}
+
+void SPECTRUM_Start(void)
+{
+	RADIO_SelectVfos();
+	RADIO_SetupRegisters(true);
+
+	// The sweep owns the receiver, keep squelch and tone events quiet
+	BK4819_WriteRegister(BK4819_REG_3F, 0);
+	BK4819_SetAF(BK4819_AF_MUTE);
+	RADIO_InvalidateProfile();
+
+	gSpectrumCentre = gRxVfo->pRX->Frequency;
+	gSpectrumStepSetting = gRxVfo->STEP_SETTING;
+	gSpectrumPoints = SPECTRUM_MAX_POINTS / 2;
+	gSpectrumRate = 0;
+	gSpectrumSweeps = 0;
+	SPECTRUM_Restart();
+}
+
+void SPECTRUM_Stop(void)
+{
+	RADIO_InvalidateProfile();
+	gRequestDisplayScreen = DISPLAY_MAIN;
+	gVfoConfigureMode = VFO_CONFIGURE_RELOAD;
+	gFlagResetVfos = true;
+}
+
@@ -0,0 +1,35 @@
+#ifndef APP_SPECTRUM_H
+#define APP_SPECTRUM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driver/keyboard.h"
+
+// Widest sweep, one point per display column
+#define SPECTRUM_MAX_POINTS 128U
+#define SPECTRUM_MIN_POINTS 32U
+// Time the BK4819 needs after a retune before REG_67 reflects the new frequency
+#ifndef SPECTRUM_DWELL_US
+#define SPECTRUM_DWELL_US 1000U
+#endif
+
+extern uint32_t gSpectrumCentre;
+extern uint32_t gSpectrumStart;
+extern uint8_t gSpectrumStepSetting;
+extern uint8_t gSpectrumPoints;
+extern uint8_t gSpectrumIndex;
+extern uint32_t gSpectrumTunedUs;
+extern uint32_t gSpectrumSweepUs;
+extern uint32_t gSpectrumRate;
+extern uint32_t gSpectrumSweeps;
+// RSSI in dBm + 160, which is REG_67 halved
+extern uint8_t gSpectrumRssi[SPECTRUM_MAX_POINTS];
+extern uint8_t gSpectrumPeak[SPECTRUM_MAX_POINTS];
+
+void SPECTRUM_ProcessKeys(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld);
+void SPECTRUM_Tune(uint32_t Frequency);
+void SPECTRUM_Start(void);
+void SPECTRUM_Stop(void);
+
+#endif
+
@@ -19,6 +19,12 @@
 #if defined(ENABLE_FMRADIO)
 #include "app/fm.h"
 #endif
+#if defined(ENABLE_PERF_STATS)
+#include "app/scanner.h"
+#endif
+#if defined(ENABLE_SPECTRUM)
+#include "app/spectrum.h"
+#endif
 #include "app/uart.h"
 #include "board.h"
 #include "bsp/dp32g030/dma.h"
@@ -28,10 +34,27 @@
 #include "driver/crc.h"
 #include "driver/eeprom.h"
 #include "driver/gpio.h"
+#if defined(ENABLE_PERF_STATS)
+#include "driver/st7565.h"
+#endif
 #include "driver/uart.h"
+#if defined(ENABLE_SPECTRUM)
+#include "frequencies.h"
+#endif
 #include "functions.h"
+#if defined(ENABLE_PERF_STATS)
+#include "init.h"
+#endif
 #include "misc.h"
+#if defined(ENABLE_PROFILER)
+#include "profiler.h"
+#endif
+#include "radio.h"
+#include "scheduler.h"
 #include "settings.h"
+#if defined(ENABLE_SPECTRUM)
+#include "ui/ui.h"
+#endif
 
 #define DMA_INDEX(x, y) (((x) + (y)) % sizeof(UART_DMA_Buffer))
 
@@ -93,6 +116,43 @@ typedef struct {
 	} Data;
 } REPLY_051D_t;
 
+typedef struct {
+	Header_t Header;
+	uint16_t Offset;
+	uint16_t Size;
+	uint32_t Timestamp;
+} CMD_054F_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t Offset;
+		uint8_t Size;
+		uint8_t Padding;
+		uint16_t Remaining;
+		uint16_t CRC;
+		uint8_t Data[128];
+	} Data;
+} REPLY_054F_t;
+
+typedef struct {
+	Header_t Header;
+	uint16_t Offset;
+	uint8_t Size;
+	bool bAllowPassword;
+	uint32_t Timestamp;
+	uint8_t Data[128];
+} CMD_0551_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t Offset;
+		uint8_t Size;
+		uint8_t Padding;
+	} Data;
+} REPLY_0551_t;
+
 typedef struct {
 	Header_t Header;
 	struct {
@@ -127,6 +187,159 @@ typedef struct {
 	uint32_t Timestamp;
 } CMD_052F_t;
 
+#if defined(ENABLE_PERF_STATS)
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Writes;
+		uint32_t WritesSkipped;
+		uint32_t Reads;
+		uint32_t ReadsCached;
+	} Data;
+} REPLY_0531_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Hops;
+		uint32_t Writes;
+		uint32_t TotalUs;
+		uint32_t MaxUs;
+		uint32_t Configures;
+		uint32_t ConfigureTotalUs;
+		uint32_t ConfigureMaxUs;
+	} Data;
+} REPLY_0533_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Count;
+		uint32_t ReadCycles;
+		uint32_t WriteCycles;
+	} Data;
+} REPLY_0537_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t TimeUs;
+		uint32_t Retunes;
+		uint32_t FastRetunes;
+	} Data;
+} REPLY_0539_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t PageWrites;
+		uint32_t PagesSkipped;
+		uint32_t BusyPolls;
+		uint32_t Deferred;
+		uint32_t Coalesced;
+	} Data;
+} REPLY_053B_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t EepromUs;
+		uint32_t FirstBlitUs;
+	} Data;
+} REPLY_053D_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Count;
+		uint32_t Cycles;
+	} Data;
+} REPLY_053F_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t TimeUs;
+		uint32_t Hops;
+		uint32_t EarlyHops;
+	} Data;
+} REPLY_0541_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t LockLatency[SCANNER_LATENCY_BUCKETS];
+		uint16_t CssLatency[SCANNER_LATENCY_BUCKETS];
+	} Data;
+} REPLY_0543_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t UpTimeMs;
+		uint32_t SleepMs;
+		uint32_t Wakeups;
+		uint32_t BatchedTicks;
+		uint16_t SleepPermille;
+	} Data;
+} REPLY_0547_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint16_t DataSize;
+		uint16_t BssSize;
+		uint16_t StackSize;
+		uint16_t StackMaxUsed;
+	} Data;
+} REPLY_054B_t;
+
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Blits;
+		uint32_t PagesSent;
+		uint32_t PagesSkipped;
+		uint32_t DataBytes;
+		uint32_t CommandBytes;
+		uint32_t BlockedUs;
+	} Data;
+} REPLY_054D_t;
+#endif
+
+#if defined(ENABLE_SPECTRUM)
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Start;
+		uint16_t Step;
+		uint8_t Points;
+		uint8_t Active;
+		uint32_t PointsPerSecond;
+		uint32_t Sweeps;
+	} Data;
+} REPLY_0545_t;
+#endif
+
+#if defined(ENABLE_PROFILER)
+typedef struct {
+	Header_t Header;
+	struct {
+		uint32_t Ticks;
+		uint32_t LateTicks;
+		uint32_t MaxLatency;
+		uint32_t MissedSlots;
+		struct {
+			uint32_t Runs;
+			uint32_t MinCycles;
+			uint32_t AvgCycles;
+			uint32_t MaxCycles;
+			uint32_t Overruns;
+		} Tasks[PROFILER_COUNT];
+	} Data;
+} REPLY_0549_t;
+#endif
+
 static const uint8_t Obfuscation[16] = { 0x16, 0x6C, 0x14, 0xE6, 0x2E, 0x91, 0x0D, 0x40, 0x21, 0x35, 0xD5, 0x40, 0x13, 0x03, 0xE9, 0x80 };
 
 static union {
@@ -141,10 +354,23 @@ static uint32_t Timestamp;
 static uint16_t gUART_WriteIndex;
 static bool bIsEncrypted = true;
 
-static void SendReply(void *pReply, uint16_t Size)
+// Read stream started by CMD_054F. Each block is framed into StreamFrame and
+// goes out UART_STREAM_CHUNK bytes per UART_HandlePending().
+static uint16_t StreamOffset;
+static uint16_t StreamRemaining;
+static bool bStreamRefused;
+static uint8_t StreamFrame[sizeof(Header_t) + sizeof(REPLY_054F_t) + sizeof(Footer_t)];
+static uint8_t StreamFrameSize;
+static uint8_t StreamFrameSent;
+
+// Bulk write acknowledged by CMD_0551 and left for UART_HandlePending(). The
+// command stays in UART_Command until then, UART_IsCommandAvailable() holds
+// the next one back.
+static const CMD_0551_t *pPendingWrite;
+
+// Obfuscates the reply in place and fills in the header and footer around it
+static void FrameReply(void *pReply, uint16_t Size, Header_t *pHeader, Footer_t *pFooter)
 {
-	Header_t Header;
-	Footer_t Footer;
 	uint8_t *pBytes;
 	uint16_t i;
 
@@ -155,19 +381,32 @@ static void SendReply(void *pReply, uint16_t Size)
 		}
 	}
 
-	Header.ID = 0xCDAB;
-	Header.Size = Size;
-	UART_Send(&Header, sizeof(Header));
-	UART_Send(pReply, Size);
+	pHeader->ID = 0xCDAB;
+	pHeader->Size = Size;
 	if (bIsEncrypted) {
-		Footer.Obfuscation[0] = Obfuscation[(Size + 0) % 16] ^ 0xFF;
-		Footer.Obfuscation[1] = Obfuscation[(Size + 1) % 16] ^ 0xFF;
+		pFooter->Obfuscation[0] = Obfuscation[(Size + 0) % 16] ^ 0xFF;
+		pFooter->Obfuscation[1] = Obfuscation[(Size + 1) % 16] ^ 0xFF;
 	} else {
-		Footer.Obfuscation[0] = 0xFF;
-		Footer.Obfuscation[1] = 0xFF;
+		pFooter->Obfuscation[0] = 0xFF;
+		pFooter->Obfuscation[1] = 0xFF;
 	}
-	Footer.ID = 0xBADC;
+	pFooter->ID = 0xBADC;
+}
 
+static void SendReply(void *pReply, uint16_t Size)
+{
+	Header_t Header;
+	Footer_t Footer;
+
+	// A stream block on the wire is finished first, the host would lose both
+	if (StreamFrameSent != StreamFrameSize) {
+		UART_Send(StreamFrame + StreamFrameSent, StreamFrameSize - StreamFrameSent);
+		StreamFrameSent = StreamFrameSize;
+	}
+
+	FrameReply(pReply, Size, &Header, &Footer);
+	UART_Send(&Header, sizeof(Header));
+	UART_Send(pReply, Size);
 	UART_Send(&Footer, sizeof(Footer));
 }
 
@@ -249,19 +488,95 @@ static void CMD_051B(const uint8_t *pBuffer)
 	SendReply(&Reply, pCmd->Size + 8);
 }
 
+// Copies the part of a write that lands in [Base, Base + Length) into the
+// RAM copy of that range.
+static bool UpdateCopy(void *pCopy, uint16_t Base, uint16_t Length, uint16_t Offset, const uint8_t *pData, uint16_t Size)
+{
+	uint16_t Start = Offset;
+	uint16_t End = Offset + Size;
+
+	if (Start < Base) {
+		Start = Base;
+	}
+	if (End > Base + Length) {
+		End = Base + Length;
+	}
+	if (Start >= End) {
+		return false;
+	}
+
+	memcpy((uint8_t *)pCopy + (Start - Base), pData + (Start - Offset), End - Start);
+
+	return true;
+}
+
+// Repacks every MR channel record a write touches into the RAM index.
+// Whole records come from the write itself, partial ones are read back
+// from the EEPROM, which by now holds the write.
+static bool UpdateChannels(uint16_t Offset, const uint8_t *pData, uint16_t Size)
+{
+	const uint16_t End = Offset + Size;
+	uint16_t Address;
+
+	if (Size == 0 || Offset > (MR_CHANNEL_LAST * 16) + 15) {
+		return false;
+	}
+
+	for (Address = Offset & ~15U; Address < End && Address <= MR_CHANNEL_LAST * 16; Address += 16) {
+		uint32_t Record[4];
+
+		if (Address >= Offset && Address + 16 <= End) {
+			memcpy(Record, pData + (Address - Offset), sizeof(Record));
+		} else {
+			EEPROM_ReadBuffer(Address, Record, sizeof(Record));
+		}
+		RADIO_PackChannel(&gMR_Channels[Address / 16], Record[0], Record[1], (const uint8_t *)&Record[2]);
+	}
+
+	return true;
+}
+
+// Commits the whole run in page writes. The password is left alone while
+// the lock screen is up, unless the host asks for it.
+static void WriteEeprom(uint16_t Offset, const uint8_t *pData, uint16_t Size, bool bAllowPassword)
+{
+	const uint16_t End = Offset + Size;
+	bool bChannels;
+
+	if (bIsInLockScreen && !bAllowPassword && Offset < 0x0EA0 && End > 0x0E98) {
+		if (Offset < 0x0E98) {
+			EEPROM_WriteBlock(Offset, pData, 0x0E98 - Offset);
+		}
+		if (End > 0x0EA0) {
+			EEPROM_WriteBlock(0x0EA0, pData + (0x0EA0 - Offset), End - 0x0EA0);
+		}
+	} else {
+		EEPROM_WriteBlock(Offset, pData, Size);
+	}
+
+	if (!gIsLocked && Offset < 0x0F40 && End > 0x0F30) {
+		BOARD_EEPROM_Init();
+		return;
+	}
+
+	// Memory channels and their attributes take effect without a reboot
+	bChannels = UpdateChannels(Offset, pData, Size);
+	bChannels |= UpdateCopy(gMR_ChannelAttributes, 0x0D60, sizeof(gMR_ChannelAttributes), Offset, pData, Size);
+	if (bChannels) {
+		RADIO_InitChannelBits();
+	}
+}
+
 static void CMD_051D(const uint8_t *pBuffer)
 {
 	const CMD_051D_t *pCmd = (const CMD_051D_t *)pBuffer;
 	REPLY_051D_t Reply;
-	bool bReloadEeprom;
 	bool bIsLocked;
 
 	if (pCmd->Timestamp != Timestamp) {
 		return;
 	}
 
-	bReloadEeprom = false;
-
 #if defined(ENABLE_FMRADIO)
 	gFmRadioCountdown = 4;
 #endif
@@ -275,28 +590,115 @@ static void CMD_051D(const uint8_t *pBuffer)
 	}
 
 	if (!bIsLocked) {
-		uint16_t i;
+		WriteEeprom(pCmd->Offset, pCmd->Data, pCmd->Size & ~7U, pCmd->bAllowPassword);
+	}
 
-		for (i = 0; i < (pCmd->Size / 8U); i++) {
-			uint16_t Offset = pCmd->Offset + (i * 8U);
+	SendReply(&Reply, sizeof(Reply));
+}
 
-			if (Offset >= 0x0F30 && Offset < 0x0F40) {
-				if (!gIsLocked) {
-					bReloadEeprom = true;
-				}
-			}
+// Bulk write of up to 128 bytes. The reply goes out before the EEPROM is
+// programmed, so the host can send the next block while the pages are
+// being written. A Size of 0 in the reply means the block was refused.
+// The pages are programmed by UART_HandlePending(), out of the IRQ-masked
+// command handler.
+static void CMD_0551(const uint8_t *pBuffer)
+{
+	const CMD_0551_t *pCmd = (const CMD_0551_t *)pBuffer;
+	REPLY_0551_t Reply;
+	bool bIsLocked;
+	bool bWrite;
 
-			if ((Offset < 0x0E98 || Offset >= 0x0EA0) || !bIsInLockScreen || pCmd->bAllowPassword) {
-				EEPROM_WriteBuffer(Offset, &pCmd->Data[i * 8U]);
-			}
-		}
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
 
-		if (bReloadEeprom) {
-			BOARD_EEPROM_Init();
-		}
+#if defined(ENABLE_FMRADIO)
+	gFmRadioCountdown = 4;
+#endif
+	Reply.Header.ID = 0x0552;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Offset = pCmd->Offset;
+	Reply.Data.Padding = 0;
+
+	bIsLocked = bHasCustomAesKey;
+	if (bHasCustomAesKey) {
+		bIsLocked = gIsLocked;
 	}
 
+	bWrite = !bIsLocked && pCmd->Size <= sizeof(pCmd->Data) && pCmd->Offset + pCmd->Size <= EEPROM_SIZE;
+	Reply.Data.Size = bWrite ? pCmd->Size : 0;
+
+	// SendReply() obfuscates the reply in place, it can't be read back
 	SendReply(&Reply, sizeof(Reply));
+
+	if (bWrite) {
+		pPendingWrite = pCmd;
+	}
+}
+
+static void FrameStreamBlock(void)
+{
+	Header_t Header;
+	Footer_t Footer;
+	REPLY_054F_t Reply;
+	uint8_t Size;
+
+	Size = sizeof(Reply.Data.Data);
+	if (StreamRemaining < Size) {
+		Size = StreamRemaining;
+	}
+
+	Reply.Header.ID = 0x0550;
+	Reply.Header.Size = Size + 8;
+	Reply.Data.Offset = StreamOffset;
+	Reply.Data.Size = Size;
+	Reply.Data.Padding = 0;
+	if (Size) {
+		EEPROM_ReadBuffer(StreamOffset, Reply.Data.Data, Size);
+	}
+	Reply.Data.CRC = CRC_Calculate(Reply.Data.Data, Size);
+
+	StreamOffset += Size;
+	StreamRemaining -= Size;
+	Reply.Data.Remaining = StreamRemaining;
+
+	FrameReply(&Reply, Size + 12, &Header, &Footer);
+	memcpy(StreamFrame, &Header, sizeof(Header));
+	memcpy(StreamFrame + sizeof(Header), &Reply, Size + 12);
+	memcpy(StreamFrame + sizeof(Header) + Size + 12, &Footer, sizeof(Footer));
+	StreamFrameSize = sizeof(Header) + Size + 12 + sizeof(Footer);
+	StreamFrameSent = 0;
+}
+
+// Streams Size bytes from Offset without a request per block. Sending it
+// again restarts the stream, which is how the host resumes after a bad
+// block. An empty block means there is nothing to send.
+static void CMD_054F(const uint8_t *pBuffer)
+{
+	const CMD_054F_t *pCmd = (const CMD_054F_t *)pBuffer;
+	bool bLocked = false;
+
+	if (pCmd->Timestamp != Timestamp) {
+		return;
+	}
+
+#if defined(ENABLE_FMRADIO)
+	gFmRadioCountdown = 4;
+#endif
+	if (bHasCustomAesKey) {
+		bLocked = gIsLocked;
+	}
+
+	StreamOffset = pCmd->Offset;
+	StreamRemaining = 0;
+	if (!bLocked && pCmd->Offset < EEPROM_SIZE) {
+		StreamRemaining = pCmd->Size;
+		if (StreamRemaining > EEPROM_SIZE - pCmd->Offset) {
+			StreamRemaining = EEPROM_SIZE - pCmd->Offset;
+		}
+	}
+
+	bStreamRefused = !StreamRemaining;
 }
 
 static void CMD_0527(void)
@@ -323,6 +725,206 @@ static void CMD_0529(void)
 	SendReply(&Reply, sizeof(Reply));
 }
 
+#if defined(ENABLE_PERF_STATS)
+static void CMD_0531(void)
+{
+	REPLY_0531_t Reply;
+
+	Reply.Header.ID = 0x0532;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Writes = gBK4819_BusStats.Writes;
+	Reply.Data.WritesSkipped = gBK4819_BusStats.WritesSkipped;
+	Reply.Data.Reads = gBK4819_BusStats.Reads;
+	Reply.Data.ReadsCached = gBK4819_BusStats.ReadsCached;
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0533(void)
+{
+	REPLY_0533_t Reply;
+
+	Reply.Header.ID = 0x0534;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Hops = gRadioHopStats.Hops;
+	Reply.Data.Writes = gRadioHopStats.Writes;
+	Reply.Data.TotalUs = gRadioHopStats.TotalUs;
+	Reply.Data.MaxUs = gRadioHopStats.MaxUs;
+	Reply.Data.Configures = gRadioHopStats.Configures;
+	Reply.Data.ConfigureTotalUs = gRadioHopStats.ConfigureTotalUs;
+	Reply.Data.ConfigureMaxUs = gRadioHopStats.ConfigureMaxUs;
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0537(void)
+{
+	REPLY_0537_t Reply;
+
+	Reply.Header.ID = 0x0538;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Count = BK4819_BENCHMARK_COUNT;
+	BK4819_BenchmarkBus(&Reply.Data.ReadCycles, &Reply.Data.WriteCycles);
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0539(void)
+{
+	REPLY_0539_t Reply;
+
+	Reply.Header.ID = 0x053A;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.TimeUs = SCHEDULER_GetTimeUs();
+	Reply.Data.Retunes = gBK4819_RetuneStats.Total;
+	Reply.Data.FastRetunes = gBK4819_RetuneStats.Fast;
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_053B(void)
+{
+	REPLY_053B_t Reply;
+
+	Reply.Header.ID = 0x053C;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.PageWrites = gEEPROM_Stats.PageWrites;
+	Reply.Data.PagesSkipped = gEEPROM_Stats.PagesSkipped;
+	Reply.Data.BusyPolls = gEEPROM_Stats.BusyPolls;
+	Reply.Data.Deferred = gEEPROM_Stats.Deferred;
+	Reply.Data.Coalesced = gEEPROM_Stats.Coalesced;
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_053D(void)
+{
+	REPLY_053D_t Reply;
+
+	Reply.Header.ID = 0x053E;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.EepromUs = gBootStats.EepromUs;
+	Reply.Data.FirstBlitUs = gBootStats.FirstBlitUs;
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_053F(void)
+{
+	REPLY_053F_t Reply;
+
+	Reply.Header.ID = 0x0540;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Count = MR_CHANNEL_LAST + 1;
+	Reply.Data.Cycles = RADIO_BenchmarkFindNext();
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0541(void)
+{
+	REPLY_0541_t Reply;
+
+	Reply.Header.ID = 0x0542;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.TimeUs = SCHEDULER_GetTimeUs();
+	Reply.Data.Hops = gScanStats.Hops;
+	Reply.Data.EarlyHops = gScanStats.EarlyHops;
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0543(void)
+{
+	REPLY_0543_t Reply;
+
+	Reply.Header.ID = 0x0544;
+	Reply.Header.Size = sizeof(Reply.Data);
+	memcpy(Reply.Data.LockLatency, gScanStats.LockLatency, sizeof(Reply.Data.LockLatency));
+	memcpy(Reply.Data.CssLatency, gScanStats.CssLatency, sizeof(Reply.Data.CssLatency));
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_0547(void)
+{
+	REPLY_0547_t Reply;
+
+	Reply.Header.ID = 0x0548;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.UpTimeMs = SCHEDULER_GetUpTimeMs();
+	Reply.Data.SleepMs = gSchedulerSleepStats.SleepMs;
+	Reply.Data.Wakeups = gSchedulerSleepStats.Wakeups;
+	Reply.Data.BatchedTicks = gSchedulerSleepStats.BatchedTicks;
+	Reply.Data.SleepPermille = 0;
+	if (Reply.Data.UpTimeMs >= 1000U) {
+		Reply.Data.SleepPermille = Reply.Data.SleepMs / (Reply.Data.UpTimeMs / 1000U);
+	}
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_054B(void)
+{
+	REPLY_054B_t Reply;
+	RAM_Usage_t Usage;
+
+	Reply.Header.ID = 0x054C;
+	Reply.Header.Size = sizeof(Reply.Data);
+	RAM_GetUsage(&Usage);
+	Reply.Data.DataSize = Usage.DataSize;
+	Reply.Data.BssSize = Usage.BssSize;
+	Reply.Data.StackSize = Usage.StackSize;
+	Reply.Data.StackMaxUsed = Usage.StackMaxUsed;
+	SendReply(&Reply, sizeof(Reply));
+}
+
+static void CMD_054D(void)
+{
+	REPLY_054D_t Reply;
+
+	Reply.Header.ID = 0x054E;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Blits = gST7565_Stats.Blits;
+	Reply.Data.PagesSent = gST7565_Stats.PagesSent;
+	Reply.Data.PagesSkipped = gST7565_Stats.PagesSkipped;
+	Reply.Data.DataBytes = gST7565_Stats.DataBytes;
+	Reply.Data.CommandBytes = gST7565_Stats.CommandBytes;
+	Reply.Data.BlockedUs = gST7565_Stats.BlockedUs;
+	SendReply(&Reply, sizeof(Reply));
+}
+#endif
+
+#if defined(ENABLE_SPECTRUM)
+static void CMD_0545(void)
+{
+	REPLY_0545_t Reply;
+
+	Reply.Header.ID = 0x0546;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Start = gSpectrumStart;
+	Reply.Data.Step = StepFrequencyTable[gSpectrumStepSetting];
+	Reply.Data.Points = gSpectrumPoints;
+	Reply.Data.Active = (gScreenToDisplay == DISPLAY_SPECTRUM);
+	Reply.Data.PointsPerSecond = gSpectrumRate;
+	Reply.Data.Sweeps = gSpectrumSweeps;
+	SendReply(&Reply, sizeof(Reply));
+}
+#endif
+
+#if defined(ENABLE_PROFILER)
+static void CMD_0549(void)
+{
+	REPLY_0549_t Reply;
+	uint8_t i;
+
+	Reply.Header.ID = 0x054A;
+	Reply.Header.Size = sizeof(Reply.Data);
+	Reply.Data.Ticks = gProfilerTick.Ticks;
+	Reply.Data.LateTicks = gProfilerTick.Late;
+	Reply.Data.MaxLatency = gProfilerTick.MaxLatency;
+	Reply.Data.MissedSlots = gProfilerTick.MissedSlots;
+	for (i = 0; i < PROFILER_COUNT; i++) {
+		Reply.Data.Tasks[i].Runs = gProfilerTasks[i].Runs;
+		Reply.Data.Tasks[i].MinCycles = gProfilerTasks[i].MinCycles;
+		Reply.Data.Tasks[i].AvgCycles = gProfilerTasks[i].AvgCycles16 >> 4;
+		Reply.Data.Tasks[i].MaxCycles = gProfilerTasks[i].MaxCycles;
+		Reply.Data.Tasks[i].Overruns = gProfilerTasks[i].Overruns;
+	}
+	SendReply(&Reply, sizeof(Reply));
+}
+#endif
+
 static void CMD_052D(const uint8_t *pBuffer)
 {
 	const CMD_052D_t *pCmd = (const CMD_052D_t *)pBuffer;
@@ -393,6 +995,10 @@ bool UART_IsCommandAvailable(void)
 	uint16_t CRC;
 	uint16_t i;
 
+	if (pPendingWrite) {
+		return false;
+	}
+
 	DmaLength = DMA_CH0->ST & 0xFFFU;
 	while (1) {
 		if (gUART_WriteIndex == DmaLength) {
@@ -515,9 +1121,113 @@ void UART_HandleCommand(void)
 		CMD_052F(UART_Command.Buffer);
 		break;
 
+	case 0x054F:
+		CMD_054F(UART_Command.Buffer);
+		break;
+
+	case 0x0551:
+		CMD_0551(UART_Command.Buffer);
+		break;
+
+#if defined(ENABLE_PERF_STATS)
+	case 0x0531:
+		CMD_0531();
+		break;
+
+	case 0x0533:
+		CMD_0533();
+		break;
+
+	case 0x0537:
+		CMD_0537();
+		break;
+
+	case 0x0539:
+		CMD_0539();
+		break;
+
+	case 0x053B:
+		CMD_053B();
+		break;
+
+	case 0x053D:
+		CMD_053D();
+		break;
+
+	case 0x053F:
+		CMD_053F();
+		break;
+
+	case 0x0541:
+		CMD_0541();
+		break;
+
+	case 0x0543:
+		CMD_0543();
+		break;
+
+	case 0x0547:
+		CMD_0547();
+		break;
+
+	case 0x054B:
+		CMD_054B();
+		break;
+
+	case 0x054D:
+		CMD_054D();
+		break;
+#endif
+
+#if defined(ENABLE_SPECTRUM)
+	case 0x0545:
+		CMD_0545();
+		break;
+#endif
+
+#if defined(ENABLE_PROFILER)
+	case 0x0549:
+		CMD_0549();
+		break;
+#endif
+
 	case 0x05DD:
+		EEPROM_Flush();
 		NVIC_SystemReset();
 		break;
 	}
 }
 
+void UART_HandlePending(void)
+{
+	uint8_t Size;
+
+	if (pPendingWrite) {
+		WriteEeprom(pPendingWrite->Offset, pPendingWrite->Data, pPendingWrite->Size, pPendingWrite->bAllowPassword);
+		pPendingWrite = NULL;
+	}
+
+	if (StreamFrameSent == StreamFrameSize) {
+		if (!StreamRemaining && !bStreamRefused) {
+			return;
+		}
+		bStreamRefused = false;
+		FrameStreamBlock();
+	}
+
+#if defined(ENABLE_FMRADIO)
+	gFmRadioCountdown = 4;
+#endif
+	Size = StreamFrameSize - StreamFrameSent;
+	if (Size > UART_STREAM_CHUNK) {
+		Size = UART_STREAM_CHUNK;
+	}
+	UART_Send(StreamFrame + StreamFrameSent, Size);
+	StreamFrameSent += Size;
+}
+
+bool UART_IsStreaming(void)
+{
+	return StreamFrameSent != StreamFrameSize || StreamRemaining || bStreamRefused;
+}
+
@@ -19,8 +19,19 @@
 
 #include <stdbool.h>
 
+// Bytes of a read stream block sent per UART_HandlePending(), about 4 ms of
+// the main loop at 38400 baud with the TX FIFO full
+#ifndef UART_STREAM_CHUNK
+#define UART_STREAM_CHUNK 16U
+#endif
+
 bool UART_IsCommandAvailable(void);
 void UART_HandleCommand(void);
+// Programs an acknowledged bulk write and sends the next piece of a read
+// stream. Runs from the main loop with interrupts enabled.
+void UART_HandlePending(void);
+// True while a read stream has more to send, the main loop should not sleep
+bool UART_IsStreaming(void);
 
 #endif
 
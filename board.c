@@ -40,8 +40,17 @@
 #include "frequencies.h"
 #include "helper/battery.h"
 #include "misc.h"
+#include "radio.h"
 #include "settings.h"
 
+#define BOARD_SETTINGS_START 0x0E70U
+#define BOARD_SETTINGS_END   0x0F48U
+#define SETTINGS_AT(x)       (&Settings[(x) - BOARD_SETTINGS_START])
+
+#if defined(ENABLE_PERF_STATS)
+BOARD_BootStats_t gBootStats;
+#endif
+
 static void BOARD_EnableInterrupts(void)
 {
 	// #define NVIC_EnableIRQ              __NVIC_EnableIRQ
@@ -522,11 +531,14 @@ void BOARD_Init(void)
 
 void BOARD_EEPROM_Init(void)
 {
-	uint8_t Data[16];
-	memset(Data, 0, sizeof(Data));
+	// 0E70..0F47 in a single sequential read, fields are parsed in place
+	uint8_t Settings[BOARD_SETTINGS_END - BOARD_SETTINGS_START];
+	uint8_t *Data;
+
+	EEPROM_ReadBuffer(BOARD_SETTINGS_START, Settings, sizeof(Settings));
 
 	// 0E70..0E77
-	EEPROM_ReadBuffer(0x0E70, Data, 16);
+	Data = SETTINGS_AT(0x0E70);
 	gEeprom.CHAN_1_CALL      = IS_MR_CHANNEL(Data[0]) ? Data[0] : MR_CHANNEL_FIRST;
 	gEeprom.SQUELCH_LEVEL    = (Data[1] < 10) ? Data[1] : 2;
 	gEeprom.TX_TIMEOUT_TIMER = (Data[2] < 11) ? Data[2] : 2;
@@ -542,7 +554,7 @@ void BOARD_EEPROM_Init(void)
 	gEeprom.VFO_OPEN              = (Data[15] < 2) ? Data[15] : 1;
 
 	// 0E80..0E87
-	EEPROM_ReadBuffer(0x0E80, Data, 8);
+	Data = SETTINGS_AT(0x0E80);
 	gEeprom.ScreenChannel[0] = IS_VALID_CHANNEL(Data[0]) ? Data[0] : (FREQ_CHANNEL_FIRST + BAND6_400MHz);
 	gEeprom.ScreenChannel[1] = IS_VALID_CHANNEL(Data[3]) ? Data[3] : (FREQ_CHANNEL_FIRST + BAND6_400MHz);
 	gEeprom.MrChannel[0]     = IS_MR_CHANNEL(Data[1])    ? Data[1] : MR_CHANNEL_FIRST;
@@ -552,7 +564,7 @@ void BOARD_EEPROM_Init(void)
 
 #if defined(ENABLE_FMRADIO)
 	// 0E88..0E8F
-	EEPROM_ReadBuffer(0x0E88, &gFM, sizeof(gFM));
+	memcpy(&gFM, SETTINGS_AT(0x0E88), sizeof(gFM));
 	if (gFM.SelectedFrequency < 760 || gFM.SelectedFrequency > 1080) {
 		gFM.SelectedFrequency = 976;
 	}
@@ -563,31 +575,33 @@ void BOARD_EEPROM_Init(void)
 #endif
 
 	// 0E90..0E97
-	EEPROM_ReadBuffer(0x0E90, Data, 8);
+	Data = SETTINGS_AT(0x0E90);
 	gEeprom.KEY_1_SHORT_PRESS_ACTION = (Data[1] < 6) ? Data[1] : 3;
 	gEeprom.KEY_1_LONG_PRESS_ACTION  = (Data[2] < 6) ? Data[2] : 4;
 	gEeprom.KEY_2_SHORT_PRESS_ACTION = (Data[3] < 6) ? Data[3] : 2;
 	gEeprom.KEY_2_LONG_PRESS_ACTION  = (Data[4] < 6) ? Data[4] : 1;
 	gEeprom.SCAN_RESUME_MODE         = (Data[5] < 3) ? Data[5] : SCAN_RESUME_CO;
 	gEeprom.AUTO_KEYPAD_LOCK         = (Data[6] < 2) ? Data[6] : 0;
+	// Non-stock memory layout
+	gEeprom.SCAN_ADAPTIVE_DWELL      = (Data[7] < 2) ? Data[7] : 0;
 
 	// 0E98..0E9F
-	EEPROM_ReadBuffer(0x0E98, Data, 4);
+	Data = SETTINGS_AT(0x0E98);
 	memcpy(&gEeprom.POWER_ON_PASSWORD, Data, 4);
 
 	// 0EA0..0EA7
 	// Non-stock memory layout, was voice prompt
-	EEPROM_ReadBuffer(0x0EA0, Data, 4);
+	Data = SETTINGS_AT(0x0EA0);
 	memcpy(&gEeprom.MDC1200_ID, Data, 4);
 
 	// 0EA8..0EAF
-	EEPROM_ReadBuffer(0x0EA8, Data, 8);
+	Data = SETTINGS_AT(0x0EA8);
 	gEeprom.ROGER                          = (Data[1] <  2) ? Data[1] : 1;
 	gEeprom.REPEATER_TAIL_TONE_ELIMINATION = (Data[2] < 11) ? Data[2] : 0;
 	gEeprom.TX_VFO                         = (Data[3] <  2) ? Data[3] : 0;
 
 	// 0ED0..0ED7
-	EEPROM_ReadBuffer(0x0ED0, Data, 16);
+	Data = SETTINGS_AT(0x0ED0);
 	gEeprom.DTMF_SIDE_TONE               = (Data[0] <   2) ? Data[0] : false;
 	gEeprom.DTMF_SEPARATE_CODE           = DTMF_ValidateCodes((char *)(Data + 1), 1) ? Data[1] : '*';
 	gEeprom.DTMF_GROUP_CALL_CODE         = DTMF_ValidateCodes((char *)(Data + 2), 1) ? Data[2] : '#';
@@ -602,7 +616,7 @@ void BOARD_EEPROM_Init(void)
 	gEeprom.DTMF_CODE_INTERVAL_TIME = (Data[9] < 101) ? Data[9] * 10 : 100;
 
 	// 0EE0..0EE7
-	EEPROM_ReadBuffer(0x0EE0, Data, 8);
+	Data = SETTINGS_AT(0x0EE0);
 	if (DTMF_ValidateCodes((char *)Data, 8)) {
 		memcpy(gEeprom.ANI_DTMF_ID, Data, 8);
 	} else {
@@ -617,7 +631,7 @@ void BOARD_EEPROM_Init(void)
 	//EEPROM_ReadBuffer(0x0EF0, Data, 8);
 
 	// 0EF8..0F07
-	EEPROM_ReadBuffer(0x0EF8, Data, 16);
+	Data = SETTINGS_AT(0x0EF8);
 	if (DTMF_ValidateCodes((char *)Data, 16)) {
 		memcpy(gEeprom.DTMF_UP_CODE, Data, 16);
 	} else {
@@ -625,7 +639,7 @@ void BOARD_EEPROM_Init(void)
 	}
 
 	// 0F08..0F17
-	EEPROM_ReadBuffer(0x0F08, Data, 16);
+	Data = SETTINGS_AT(0x0F08);
 	if (DTMF_ValidateCodes((char *)Data, 16)) {
 		memcpy(gEeprom.DTMF_DOWN_CODE, Data, 16);
 	} else {
@@ -633,7 +647,7 @@ void BOARD_EEPROM_Init(void)
 	}
 
 	// 0F18..0F1F
-	EEPROM_ReadBuffer(0x0F18, Data, 8);
+	Data = SETTINGS_AT(0x0F18);
 	gEeprom.SCAN_LIST_DEFAULT        = (Data[0] < 2) ? Data[0] : 0;
 	for (uint8_t i = 0; i < 2; i++) {
 		uint8_t j = (i * 3) + 1;
@@ -643,7 +657,7 @@ void BOARD_EEPROM_Init(void)
 	}
 
 	// 0F40..0F47
-	EEPROM_ReadBuffer(0x0F40, Data, 8);
+	Data = SETTINGS_AT(0x0F40);
 	gSetting_F_LOCK = (Data[0] < 4) ? Data[0] : F_LOCK_OFF;
 
 	// gSetting_350TX  = (Data[1] < 2) ? Data[1] : 0;
@@ -658,8 +672,20 @@ void BOARD_EEPROM_Init(void)
 	// 0D60..0E27
 	EEPROM_ReadBuffer(0x0D60, gMR_ChannelAttributes, sizeof(gMR_ChannelAttributes));
 
+	RADIO_InitChannelBits();
+
+	// 0000..0C7F, 8 channels per read as the size is only 8 bits wide
+	for (uint8_t i = 0; i <= MR_CHANNEL_LAST; i += 8) {
+		uint32_t Records[8][4];
+
+		EEPROM_ReadBuffer(i * 16, Records, sizeof(Records));
+		for (uint8_t j = 0; j < 8; j++) {
+			RADIO_PackChannel(&gMR_Channels[i + j], Records[j][0], Records[j][1], (const uint8_t *)&Records[j][2]);
+		}
+	}
+
 	// 0F30..0F3F
-	EEPROM_ReadBuffer(0x0F30, gCustomAesKey, sizeof(gCustomAesKey));
+	memcpy(gCustomAesKey, SETTINGS_AT(0x0F30), sizeof(gCustomAesKey));
 	if (gCustomAesKey[0] != 0xFFFFFFFFU || gCustomAesKey[1] != 0xFFFFFFFFU ||
 		gCustomAesKey[2] != 0xFFFFFFFFU || gCustomAesKey[3] != 0xFFFFFFFFU)
 	{
@@ -671,27 +697,31 @@ void BOARD_EEPROM_Init(void)
 
 void BOARD_EEPROM_LoadCalibration(void)
 {
-	EEPROM_ReadBuffer(0x1EC0, gEEPROM_RSSI_CALIB[3], 8);
+	// 1F40..1F8F: battery, mic and BK4819 calibration in one read
+	uint8_t Calibration[0x1F88 - 0x1F40 + sizeof(gCalibration)];
+
+	// 1EC0..1ECF, 1EC8 lands in row 4 and is moved to row 0 before row 4 is refilled
+	EEPROM_ReadBuffer(0x1EC0, gEEPROM_RSSI_CALIB[3], 8 * 2);
+	memcpy(gEEPROM_RSSI_CALIB[0], gEEPROM_RSSI_CALIB[4], 8);
 	memcpy(gEEPROM_RSSI_CALIB[4], gEEPROM_RSSI_CALIB[3], 8);
 	memcpy(gEEPROM_RSSI_CALIB[5], gEEPROM_RSSI_CALIB[3], 8);
 	memcpy(gEEPROM_RSSI_CALIB[6], gEEPROM_RSSI_CALIB[3], 8);
 
-	EEPROM_ReadBuffer(0x1EC8, gEEPROM_RSSI_CALIB[0], 8);
 	memcpy(gEEPROM_RSSI_CALIB[1], gEEPROM_RSSI_CALIB[0], 8);
 	memcpy(gEEPROM_RSSI_CALIB[2], gEEPROM_RSSI_CALIB[0], 8);
 
-	EEPROM_ReadBuffer(0x1F40, gBatteryCalibration, sizeof(gBatteryCalibration));
+	EEPROM_ReadBuffer(0x1F40, Calibration, sizeof(Calibration));
+	memcpy(gBatteryCalibration, &Calibration[0], sizeof(gBatteryCalibration));
 	if (gBatteryCalibration[0] >= 5000) {
 		gBatteryCalibration[0] = 1900;
 		gBatteryCalibration[1] = 2000;
 	}
 	gBatteryCalibration[5] = 2300;
 
-	uint8_t Mic;
-	EEPROM_ReadBuffer(0x1F80 + gEeprom.MIC_SENSITIVITY, &Mic, 1);
+	uint8_t Mic = Calibration[0x1F80 - 0x1F40 + gEeprom.MIC_SENSITIVITY];
 	gEeprom.MIC_SENSITIVITY_TUNING = (Mic < 32) ? Mic : 16; // 0.5dB per step
 
-	EEPROM_ReadBuffer(0x1F88, &gCalibration, sizeof(gCalibration));
+	memcpy(&gCalibration, &Calibration[0x1F88 - 0x1F40], sizeof(gCalibration));
 	BK4819_WriteRegister(BK4819_REG_3B, gCalibration.BK4819_XTAL_FREQ_LOW + 22656);
 }
 
@@ -20,6 +20,15 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#if defined(ENABLE_PERF_STATS)
+typedef struct {
+	uint32_t EepromUs;
+	uint32_t FirstBlitUs;
+} BOARD_BootStats_t;
+
+extern BOARD_BootStats_t gBootStats;
+#endif
+
 void BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage, uint16_t *pCurrent);
 void BOARD_Init(void);
 void BOARD_EEPROM_Init(void);
@@ -63,26 +63,42 @@ const uint16_t DCS_Options[104] = {
 	0x01DA, 0x01DC, 0x01E3, 0x01EC,
 };
 
-static uint32_t DCS_CalculateGolay(uint32_t CodeWord)
-{
-	uint32_t Word;
-	uint8_t i;
-
-	Word = CodeWord;
-	for (i = 0; i < 12; i++) {
-		Word <<= 1;
-		if (Word & 0x1000) {
-			Word ^= 0x08EA;
-		}
-	}
-	return CodeWord | ((Word & 0x0FFE) << 11);
-}
+// Golay (23,12) code words of DCS_Options, each option | 0x800 in the low
+// 12 bits and its 11 check bits (generator 0x08EA) above them
+static const uint32_t DCS_CodeWords[104] = {
+	0x763813, 0x6B7815, 0x65D816, 0x51F819,
+	0x5F581A, 0x0BE81E, 0x5B6823, 0x0FD827,
+	0x7CA829, 0x35582B, 0x6F482C, 0x5D1835,
+	0x679839, 0x69383A, 0x2E683B, 0x74783C,
+	0x35E84C, 0x72B84D, 0x7C184E, 0x5DA852,
+	0x07B855, 0x3D3859, 0x33985A, 0x2ED85C,
+	0x37A863, 0x2AE865, 0x1EC86A, 0x44D86D,
+	0x4A786E, 0x6BC872, 0x31D875, 0x05F87A,
+	0x18B87C, 0x6E9885, 0x5AB88A, 0x68E893,
+	0x75A895, 0x7B0896, 0x45B8A3, 0x1FA8A4,
+	0x58F8A5, 0x5658A6, 0x6278A9, 0x6CD8AA,
+	0x36C8AD, 0x1778B1, 0x5E88B3, 0x43C8B5,
+	0x4D68B6, 0x7948B9, 0x6AA8BC, 0x0CF8C6,
+	0x38D8C9, 0x6C68CD, 0x1968D5, 0x23E8D9,
+	0x2D48DA, 0x2978E3, 0x3A98E6, 0x0EB8E9,
+	0x54A8EE, 0x6858F4, 0x2F08F5, 0x1588F9,
+	0x776909, 0x79C90A, 0x3E990B, 0x4B9913,
+	0x6C5919, 0x62F91A, 0x7B8925, 0x752926,
+	0x4FA92A, 0x52E92C, 0x15B92D, 0x3AA932,
+	0x27E934, 0x60B935, 0x6E1936, 0x3C6943,
+	0x2F8946, 0x41B94E, 0x275953, 0x34B956,
+	0x0E395A, 0x19E966, 0x0C7975, 0x5D9986,
+	0x67198A, 0x0F5994, 0x01F997, 0x728999,
+	0x7C299A, 0x4C39AC, 0x2479B2, 0x3939B4,
+	0x22B9C3, 0x0BD9CA, 0x3989D3, 0x1E49D9,
+	0x10E9DA, 0x0DA9DC, 0x14D9E3, 0x20F9EC,
+};
 
 uint32_t DCS_GetGolayCodeWord(DCS_CodeType_t CodeType, uint8_t Option)
 {
 	uint32_t Code;
 
-	Code = DCS_CalculateGolay(DCS_Options[Option] + 0x800U);
+	Code = DCS_CodeWords[Option];
 	if (CodeType == CODE_TYPE_REVERSE_DIGITAL) {
 		Code ^= 0x7FFFFF;
 	}
@@ -90,6 +106,28 @@ uint32_t DCS_GetGolayCodeWord(DCS_CodeType_t CodeType, uint8_t Option)
 	return Code;
 }
 
+static uint8_t DCS_FindOption(uint16_t Code)
+{
+	uint8_t Low = 0;
+	uint8_t High = 104;
+
+	// DCS_Options is sorted
+	while (Low < High) {
+		const uint8_t Mid = (Low + High) / 2;
+
+		if (DCS_Options[Mid] < Code) {
+			Low = Mid + 1;
+		} else {
+			High = Mid;
+		}
+	}
+	if (Low < 104 && DCS_Options[Low] == Code) {
+		return Low;
+	}
+
+	return 0xFF;
+}
+
 uint8_t DCS_GetCdcssCode(uint32_t Code)
 {
 	uint8_t i;
@@ -98,14 +136,10 @@ uint8_t DCS_GetCdcssCode(uint32_t Code)
 		uint32_t Shift;
 
 		if (((Code >> 9) & 0x7U) == 4) {
-			uint8_t j;
-
-			for (j = 0; j < 104; j++) {
-				if (DCS_Options[j] == (Code & 0x1FF)) {
-					if (DCS_GetGolayCodeWord(2, j) == Code) {
-						return j;
-					}
-				}
+			const uint8_t j = DCS_FindOption(Code & 0x1FF);
+
+			if (j != 0xFF && DCS_CodeWords[j] == Code) {
+				return j;
 			}
 		}
 		Shift = Code >> 1;
@@ -18,6 +18,8 @@
  *     limitations under the License.
  */
 
+#include <string.h>
+#include "ARMCM0.h"
 #include "bsp/dp32g030/gpio.h"
 #include "bsp/dp32g030/portcon.h"
 #include "driver/bk4819.h"
@@ -35,8 +37,94 @@ __inline static uint16_t ScaleFreq(const uint16_t freq)
 }
 #endif
 
+// Registers that are strobes, indexed tables, FIFOs or status, so must
+// always reach the chip and never be answered from the shadow copy.
+static const uint32_t Volatile[4] = {
+	(1U << 0x00) | (1U << 0x02) | (1U << 0x08) | (1U << 0x09) |
+	(1U << 0x0B) | (1U << 0x0C) | (1U << 0x0D) | (1U << 0x0E),
+	(1U << (0x30 - 32)),
+	(1U << (0x59 - 64)) | (1U << (0x5E - 64)) | (1U << (0x5F - 64)),
+	0,
+};
+
+// Last value written to each register, valid only once written since reset
+static uint16_t gBK4819_Shadow[128];
+static uint32_t gBK4819_ShadowValid[4];
+
 static uint16_t gBK4819_GpioOutState;
+#if defined(ENABLE_FAST_RETUNE)
+static uint16_t gBK4819_Reg30;
+#endif
 bool gRxIdleMode;
+#if defined(ENABLE_PERF_STATS)
+BK4819_BusStats_t gBK4819_BusStats;
+BK4819_RetuneStats_t gBK4819_RetuneStats;
+#endif
+
+static const BK4819_Sequence_t InitSequence[] = {
+	{ BK4819_REG_09, 0, 0, 0x006F },
+	{ BK4819_REG_09, 0, 0, 0x106B },
+	{ BK4819_REG_09, 0, 0, 0x2067 },
+	{ BK4819_REG_09, 0, 0, 0x3062 },
+	{ BK4819_REG_09, 0, 0, 0x4050 },
+	{ BK4819_REG_09, 0, 0, 0x5047 },
+	{ BK4819_REG_09, 0, 0, 0x603A },
+	{ BK4819_REG_09, 0, 0, 0x702C },
+	{ BK4819_REG_09, 0, 0, 0x8041 },
+	{ BK4819_REG_09, 0, 0, 0x9037 },
+	{ BK4819_REG_09, 0, 0, 0xA025 },
+	{ BK4819_REG_09, 0, 0, 0xB017 },
+	{ BK4819_REG_09, 0, 0, 0xC0E4 },
+	{ BK4819_REG_09, 0, 0, 0xD0CB },
+	{ BK4819_REG_09, 0, 0, 0xE0B5 },
+	{ BK4819_REG_09, 0, 0, 0xF09F },
+	{ BK4819_REG_1F, 0, 0, 0x5454 },
+	{ BK4819_REG_3E, 0, 0, 0xA037 },
+};
+
+// kamilsss655
+static const BK4819_Sequence_t AgcSequence[] = {
+	{ BK4819_REG_7E, 0, 0,              // 1o11
+		(0u << 15) |                    // 0 AGC fix mode
+		(3u << 12) |                    // 3 AGC fix index
+		(5u <<  3) |                    // 5 DC filter bandwidth for Tx
+		(6u <<  0) },                   // 6 DC filter bandwidth for Rx
+
+	// AGC fix indexes
+	{ BK4819_REG_13, 0, 0, 0x03BE },    // 3
+	{ BK4819_REG_12, 0, 0, 0x037B },    // 2
+	{ BK4819_REG_11, 0, 0, 0x027B },    // 1
+	{ BK4819_REG_10, 0, 0, 0x007A },    // 0
+	{ BK4819_REG_14, 0, 0, 0x0019 },    // -1
+
+	// kamilsss655: what is this for? turned off, seems like rssi is increased?
+	// bricky149: Leaving enabled to retain stock behaviour
+	{ BK4819_REG_7B, 0, 0, 0x8420 },
+};
+
+static const BK4819_Sequence_t TxOnSequence[] = {
+	{ BK4819_REG_37, 0, 0, 0x1D0F },
+	{ BK4819_REG_52, 0, 0, 0x028F },
+	{ BK4819_REG_30, 0, 0, 0 },
+	{ BK4819_REG_30, 0, 0, 0xC1FE },
+};
+
+#if defined(ENABLE_DIGITAL_MODULATION)
+static const BK4819_Sequence_t DigitalTxSequence[] = {
+	// Mute output audio and bypass all AF TX filters.
+	{ BK4819_REG_47, 0, 0,      (2u << 12) | (BK4819_AF_MUTE << 8) | (1u << 6) | 1 },
+	// Disable Mic AGC and TX DC filter.
+	{ BK4819_REG_7E, 0, 0xFFC7, 0x8000 },
+	// Disable Voice FM AF TX filters
+	{ BK4819_REG_2B, 0, 0xFFF8, 0x0007 },
+	// Disable ALC
+	{ BK4819_REG_4B, 0, 0,      (1 << 15) },
+	// Disable MIC AGC
+	{ BK4819_REG_19, 0, 0,      0x1041 },
+	// Set Mic Sensitivity
+	{ BK4819_REG_7D, 0, 0,      0xE940 },
+};
+#endif
 
 void BK4819_Init(void)
 {
@@ -51,24 +139,7 @@ void BK4819_Init(void)
 	//BK4819_WriteRegister(BK4819_REG_19, 0x1041);
 	//BK4819_WriteRegister(BK4819_REG_7D, 0xE940);
 	//BK4819_WriteRegister(BK4819_REG_48, 0xB3A8);
-	BK4819_WriteRegister(BK4819_REG_09, 0x006F);
-	BK4819_WriteRegister(BK4819_REG_09, 0x106B);
-	BK4819_WriteRegister(BK4819_REG_09, 0x2067);
-	BK4819_WriteRegister(BK4819_REG_09, 0x3062);
-	BK4819_WriteRegister(BK4819_REG_09, 0x4050);
-	BK4819_WriteRegister(BK4819_REG_09, 0x5047);
-	BK4819_WriteRegister(BK4819_REG_09, 0x603A);
-	BK4819_WriteRegister(BK4819_REG_09, 0x702C);
-	BK4819_WriteRegister(BK4819_REG_09, 0x8041);
-	BK4819_WriteRegister(BK4819_REG_09, 0x9037);
-	BK4819_WriteRegister(BK4819_REG_09, 0xA025);
-	BK4819_WriteRegister(BK4819_REG_09, 0xB017);
-	BK4819_WriteRegister(BK4819_REG_09, 0xC0E4);
-	BK4819_WriteRegister(BK4819_REG_09, 0xD0CB);
-	BK4819_WriteRegister(BK4819_REG_09, 0xE0B5);
-	BK4819_WriteRegister(BK4819_REG_09, 0xF09F);
-	BK4819_WriteRegister(BK4819_REG_1F, 0x5454);
-	BK4819_WriteRegister(BK4819_REG_3E, 0xA037);
+	BK4819_WriteSequence(InitSequence, sizeof(InitSequence) / sizeof(InitSequence[0]));
 	BK4819_InitAGC();
 
 	gBK4819_GpioOutState = 0x9000;
@@ -76,7 +147,92 @@ void BK4819_Init(void)
 	BK4819_WriteRegister(BK4819_REG_3F, 0);
 }
 
-uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register)
+#if defined(ENABLE_FAST_BK4819_BUS)
+#define BUS_SCN (1U << GPIOC_PIN_BK4819_SCN)
+#define BUS_SCL (1U << GPIOC_PIN_BK4819_SCL)
+#define BUS_SDA (1U << GPIOC_PIN_BK4819_SDA)
+#define BUS_MASK (BUS_SCN | BUS_SCL | BUS_SDA)
+
+// Six NOPs and the loop around them: at least 6 cycles, 0.125 us at 48 MHz,
+// the rest depends on the code emitted and has not been timed on the radio
+// (UART command 0x0537 does that). GPIO_SetBit/ClearBit hold every level for
+// 2 us, this keeps a fixed margin that does not depend on call overhead or LTO.
+static inline void BusDelay(void)
+{
+	for (uint8_t i = 0; i < 6; i++) {
+		__NOP();
+	}
+}
+
+// Whole DATA words are written, so nothing else may touch GPIOC from an
+// interrupt while a transaction is in progress.
+static uint32_t BusStart(void)
+{
+	const uint32_t Idle = GPIOC->DATA | BUS_MASK;
+
+	GPIOC->DATA = Idle & ~BUS_SCL;
+	BusDelay();
+	GPIOC->DATA = Idle & ~BUS_MASK;
+	BusDelay();
+
+	return Idle & ~BUS_MASK;
+}
+
+static void BusStop(uint32_t Base)
+{
+	GPIOC->DATA = Base | BUS_SCN;
+	BusDelay();
+	GPIOC->DATA = Base | BUS_MASK;
+}
+
+static void BusShiftOut(uint32_t Base, uint16_t Data, uint8_t Bits)
+{
+	while (Bits--) {
+		const uint32_t Low = (Data & (1U << Bits)) ? (Base | BUS_SDA) : Base;
+
+		GPIOC->DATA = Low;
+		BusDelay();
+		GPIOC->DATA = Low | BUS_SCL;
+		BusDelay();
+		GPIOC->DATA = Low;
+	}
+}
+
+static uint16_t BK4819_ReadBus(BK4819_REGISTER_t Register)
+{
+	const uint32_t Base = BusStart();
+	uint16_t Value;
+
+	BusShiftOut(Base, Register | 0x80, 8);
+
+	PORTCON_PORTC_IE = (PORTCON_PORTC_IE & ~PORTCON_PORTC_IE_C2_MASK) | PORTCON_PORTC_IE_C2_BITS_ENABLE;
+	GPIOC->DIR = (GPIOC->DIR & ~GPIO_DIR_2_MASK) | GPIO_DIR_2_BITS_INPUT;
+	Value = 0;
+	for (int i = 0; i < 16; i++) {
+		BusDelay();
+		Value = (Value << 1) | ((GPIOC->DATA >> GPIOC_PIN_BK4819_SDA) & 1U);
+		GPIOC->DATA = Base | BUS_SCL;
+		BusDelay();
+		GPIOC->DATA = Base;
+	}
+	PORTCON_PORTC_IE = (PORTCON_PORTC_IE & ~PORTCON_PORTC_IE_C2_MASK) | PORTCON_PORTC_IE_C2_BITS_DISABLE;
+	GPIOC->DIR = (GPIOC->DIR & ~GPIO_DIR_2_MASK) | GPIO_DIR_2_BITS_OUTPUT;
+
+	BusStop(Base);
+
+	return Value;
+}
+
+static void BK4819_WriteBus(BK4819_REGISTER_t Register, uint16_t Data)
+{
+	const uint32_t Base = BusStart();
+
+	BusShiftOut(Base, Register, 8);
+	BusShiftOut(Base, Data, 16);
+	BusStop(Base);
+}
+#else
+static uint16_t BK4819_ReadBus(BK4819_REGISTER_t Register)
 {
 	uint16_t Value;
 
@@ -107,7 +263,7 @@ uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register)
 	return Value;
 }
 
-void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data)
+static void BK4819_WriteBus(BK4819_REGISTER_t Register, uint16_t Data)
 {
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCN);
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
@@ -131,7 +287,80 @@ void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data)
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 	GPIO_SetBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SDA);
 }
+#endif
+
+uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register)
+{
+	Register &= 0x7F;
+
+	if (gBK4819_ShadowValid[Register >> 5] & (1U << (Register & 31))) {
+#if defined(ENABLE_PERF_STATS)
+		gBK4819_BusStats.ReadsCached++;
+#endif
+		return gBK4819_Shadow[Register];
+	}
+
+#if defined(ENABLE_PERF_STATS)
+	gBK4819_BusStats.Reads++;
+#endif
+
+	return BK4819_ReadBus(Register);
+}
+
+void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data)
+{
+	uint32_t Bit;
+
+	Register &= 0x7F;
+	Bit = 1U << (Register & 31);
+
+	if (Register == BK4819_REG_00) {
+		// Soft reset puts every register back to its power-on default
+		memset(gBK4819_ShadowValid, 0, sizeof(gBK4819_ShadowValid));
+#if defined(ENABLE_FAST_RETUNE)
+		gBK4819_Reg30 = 0;
+	} else if (Register == BK4819_REG_30) {
+		gBK4819_Reg30 = Data;
+#endif
+	} else if ((Volatile[Register >> 5] & Bit) == 0) {
+		if ((gBK4819_ShadowValid[Register >> 5] & Bit) && gBK4819_Shadow[Register] == Data) {
+#if defined(ENABLE_PERF_STATS)
+			gBK4819_BusStats.WritesSkipped++;
+#endif
+			return;
+		}
+		gBK4819_Shadow[Register] = Data;
+		gBK4819_ShadowValid[Register >> 5] |= Bit;
+	}
+
+#if defined(ENABLE_PERF_STATS)
+	gBK4819_BusStats.Writes++;
+#endif
+
+	BK4819_WriteBus(Register, Data);
+}
+
+void BK4819_WriteSequence(const BK4819_Sequence_t *pSequence, uint8_t Count)
+{
+	for (; Count > 0; Count--, pSequence++) {
+		uint16_t Value = pSequence->Value;
+
+		if (pSequence->Keep) {
+			Value |= BK4819_ReadRegister(pSequence->Register) & pSequence->Keep;
+		}
+		BK4819_WriteRegister(pSequence->Register, Value);
+		if (pSequence->DelayMs) {
+			SYSTEM_DelayMs(pSequence->DelayMs);
+		}
+	}
+}
 
+#if defined(ENABLE_FAST_BK4819_BUS)
+void BK4819_WriteU8(uint8_t Data)
+{
+	BusShiftOut(GPIOC->DATA & ~(BUS_SCL | BUS_SDA), Data, 8);
+}
+#else
 void BK4819_WriteU8(uint8_t Data)
 {
 	GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
@@ -147,26 +376,36 @@ void BK4819_WriteU8(uint8_t Data)
 		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_BK4819_SCL);
 	}
 }
+#endif
 
-// kamilsss655
-void BK4819_InitAGC(void)
+#if defined(ENABLE_PERF_STATS)
+void BK4819_BenchmarkBus(uint32_t *pReadCycles, uint32_t *pWriteCycles)
 {
-	BK4819_WriteRegister(BK4819_REG_7E, // 1o11
-		(0u << 15) |                    // 0 AGC fix mode
-		(3u << 12) |                    // 3 AGC fix index
-		(5u <<  3) |                    // 5 DC filter bandwidth for Tx
-		(6u <<  0));                    // 6 DC filter bandwidth for Rx
+	uint16_t Value;
+	uint32_t Start;
+	uint8_t i;
 
-	// AGC fix indexes
-	BK4819_WriteRegister(BK4819_REG_13, 0x03BE); // 3
-	BK4819_WriteRegister(BK4819_REG_12, 0x037B); // 2
-	BK4819_WriteRegister(BK4819_REG_11, 0x027B); // 1
-	BK4819_WriteRegister(BK4819_REG_10, 0x007A); // 0
-	BK4819_WriteRegister(BK4819_REG_14, 0x0019); // -1
+	// Rewrite the interrupt mask with its current value, which is harmless
+	Value = BK4819_ReadRegister(BK4819_REG_3F);
 
-	// kamilsss655: what is this for? turned off, seems like rssi is increased?
-	// bricky149: Leaving enabled to retain stock behaviour
-	BK4819_WriteRegister(BK4819_REG_7B, 0x8420);
+	*pReadCycles = 0;
+	*pWriteCycles = 0;
+	for (i = 0; i < BK4819_BENCHMARK_COUNT; i++) {
+		Start = SysTick->VAL;
+		BK4819_ReadBus(BK4819_REG_0C);
+		*pReadCycles += SYSTICK_ElapsedCycles(Start);
+
+		Start = SysTick->VAL;
+		BK4819_WriteBus(BK4819_REG_3F, Value);
+		*pWriteCycles += SYSTICK_ElapsedCycles(Start);
+	}
+}
+#endif
+
+// kamilsss655
+void BK4819_InitAGC(void)
+{
+	BK4819_WriteSequence(AgcSequence, sizeof(AgcSequence) / sizeof(AgcSequence[0]));
 }
 void BK4819_SetAGC(BK4819_ModType_t ModType)
 {
@@ -461,10 +700,44 @@ void BK4819_SetupPowerAmplifier(uint8_t Bias, uint32_t Frequency)
 
 void BK4819_SetFrequency(uint32_t Frequency)
 {
+#if defined(ENABLE_PERF_STATS)
+	gBK4819_RetuneStats.Total++;
+#endif
 	BK4819_WriteRegister(BK4819_REG_38, (Frequency >>  0) & 0xFFFF);
 	BK4819_WriteRegister(BK4819_REG_39, (Frequency >> 16) & 0xFFFF);
 }
 
+#if defined(ENABLE_FAST_RETUNE)
+bool BK4819_FastRetune(uint32_t Frequency)
+{
+	uint32_t Previous;
+	uint32_t Delta;
+
+	// Only valid while the RX link set up by BK4819_RX_TurnOn is running
+	if (gBK4819_Reg30 != 0xBFF1) {
+		return false;
+	}
+	if ((gBK4819_ShadowValid[BK4819_REG_38 >> 5] & (3U << (BK4819_REG_38 & 31))) != (3U << (BK4819_REG_38 & 31))) {
+		return false;
+	}
+
+	Previous = ((uint32_t)gBK4819_Shadow[BK4819_REG_39] << 16) | gBK4819_Shadow[BK4819_REG_38];
+	Delta = (Frequency > Previous) ? Frequency - Previous : Previous - Frequency;
+
+	// Stay on the same LNA path (see BK4819_SelectFilter) and within lock range
+	if (Delta > BK4819_FAST_RETUNE_MAX_DELTA || (Previous < 28000000) != (Frequency < 28000000)) {
+		return false;
+	}
+
+	BK4819_SetFrequency(Frequency);
+#if defined(ENABLE_PERF_STATS)
+	gBK4819_RetuneStats.Fast++;
+#endif
+
+	return true;
+}
+#endif
+
 void BK4819_SetupSquelch(uint8_t SquelchOpenRSSIThresh, uint8_t SquelchCloseRSSIThresh, uint8_t SquelchOpenNoiseThresh, uint8_t SquelchCloseNoiseThresh, uint8_t SquelchCloseGlitchThresh, uint8_t SquelchOpenGlitchThresh)
 {
 	BK4819_WriteRegister(BK4819_REG_70, 0);
@@ -682,18 +955,7 @@ void BK4819_ExitBypass(void)
 #if defined(ENABLE_DIGITAL_MODULATION)
 void BK4819_PrepareDigitalTransmit(const BK4819_FilterBandwidth_t Bandwidth)
 {
-	// Mute output audio and bypass all AF TX filters.
-	BK4819_WriteRegister(BK4819_REG_47, (2u << 12) | (BK4819_AF_MUTE << 8) | (1u << 6) | 1);
-	// Disable Mic AGC and TX DC filter.
-	BK4819_WriteRegister(BK4819_REG_7E, (BK4819_ReadRegister(BK4819_REG_7E) & 0xFFC7) | 0x8000);
-	// Disable Voice FM AF TX filters
-	BK4819_WriteRegister(BK4819_REG_2B, (BK4819_ReadRegister(BK4819_REG_2B) & 0xFFF8) | 0x7);
-	// Disable ALC
-	BK4819_WriteRegister(BK4819_REG_4B, (1 << 15));
-	// Disable MIC AGC
-	BK4819_WriteRegister(BK4819_REG_19, 0x1041);
-	// Set Mic Sensitivity
-	BK4819_WriteRegister(BK4819_REG_7D, 0xE940);
+	BK4819_WriteSequence(DigitalTxSequence, sizeof(DigitalTxSequence) / sizeof(DigitalTxSequence[0]));
 	// Set Deviation
 	// This should be moved into EEPROM settings.
 	switch (Bandwidth)
@@ -723,10 +985,7 @@ void BK4819_PrepareTransmit(void)
 
 void BK4819_TxOn_Beep(void)
 {
-	BK4819_WriteRegister(BK4819_REG_37, 0x1D0F);
-	BK4819_WriteRegister(BK4819_REG_52, 0x028F);
-	BK4819_WriteRegister(BK4819_REG_30, 0);
-	BK4819_WriteRegister(BK4819_REG_30, 0xC1FE);
+	BK4819_WriteSequence(TxOnSequence, sizeof(TxOnSequence) / sizeof(TxOnSequence[0]));
 }
 
 void BK4819_ExitSubAu(void)
@@ -935,6 +1194,16 @@ uint16_t BK4819_GetRSSI(void)
 	return BK4819_ReadRegister(BK4819_REG_67) & 0x01FF;
 }
 
+uint8_t BK4819_GetExNoise(void)
+{
+	return BK4819_ReadRegister(BK4819_REG_65) & 0x007F;
+}
+
+uint8_t BK4819_GetGlitch(void)
+{
+	return BK4819_ReadRegister(BK4819_REG_63) & 0x00FF;
+}
+
 bool BK4819_GetFrequencyScanResult(uint32_t *pFrequency)
 {
 	uint16_t High, Low;
@@ -67,12 +67,52 @@ enum BK4819_CssScanResult_t {
 
 typedef enum BK4819_CssScanResult_t BK4819_CssScanResult_t;
 
+// One step of a register sequence. Bits set in Keep are preserved from the
+// current register contents, a Keep of 0 is a plain write.
+typedef struct {
+	uint8_t Register;
+	uint8_t DelayMs;
+	uint16_t Keep;
+	uint16_t Value;
+} BK4819_Sequence_t;
+
 extern bool gRxIdleMode;
 
+#if defined(ENABLE_PERF_STATS)
+typedef struct {
+	uint32_t Writes;
+	uint32_t WritesSkipped;
+	uint32_t Reads;
+	uint32_t ReadsCached;
+} BK4819_BusStats_t;
+
+extern BK4819_BusStats_t gBK4819_BusStats;
+
+#define BK4819_BENCHMARK_COUNT 16U
+
+typedef struct {
+	uint32_t Total;
+	uint32_t Fast;
+} BK4819_RetuneStats_t;
+
+extern BK4819_RetuneStats_t gBK4819_RetuneStats;
+#endif
+
+#if defined(ENABLE_FAST_RETUNE)
+// Largest hop, in 10 Hz units, that is retuned without restarting the RX link
+#if !defined(BK4819_FAST_RETUNE_MAX_DELTA)
+#define BK4819_FAST_RETUNE_MAX_DELTA 100000U
+#endif
+#endif
+
 void BK4819_Init(void);
 uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register);
 void BK4819_WriteRegister(BK4819_REGISTER_t Register, uint16_t Data);
 void BK4819_WriteU8(uint8_t Data);
+void BK4819_WriteSequence(const BK4819_Sequence_t *pSequence, uint8_t Count);
+#if defined(ENABLE_PERF_STATS)
+void BK4819_BenchmarkBus(uint32_t *pReadCycles, uint32_t *pWriteCycles);
+#endif
 
 void BK4819_InitAGC(void);
 void BK4819_SetAGC(BK4819_ModType_t ModType);
@@ -87,6 +127,9 @@ void BK4819_Set55HzTailDetection(void);
 void BK4819_SetFilterBandwidth(BK4819_FilterBandwidth_t Bandwidth, bool weak_no_different);
 void BK4819_SetupPowerAmplifier(uint8_t Bias, uint32_t Frequency);
 void BK4819_SetFrequency(uint32_t Frequency);
+#if defined(ENABLE_FAST_RETUNE)
+bool BK4819_FastRetune(uint32_t Frequency);
+#endif
 void BK4819_SetupSquelch(
 		uint8_t SquelchOpenRSSIThresh, uint8_t SquelchCloseRSSIThresh,
 		uint8_t SquelchOpenNoiseThresh, uint8_t SquelchCloseNoiseThresh,
@@ -133,6 +176,8 @@ void BK4819_EnableCDCSS(void);
 void BK4819_EnableCTCSS(void);
 
 uint16_t BK4819_GetRSSI(void);
+uint8_t BK4819_GetExNoise(void);
+uint8_t BK4819_GetGlitch(void);
 
 bool BK4819_GetFrequencyScanResult(uint32_t *pFrequency);
 BK4819_CssScanResult_t BK4819_GetCxCSSScanResult(uint32_t *pCdcssFreq, uint16_t *pCtcssFreq);
@@ -20,7 +20,20 @@
 #include "driver/i2c.h"
 #include "driver/system.h"
 
-void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
+typedef struct {
+	uint16_t Address;
+	uint8_t Data[8];
+} EEPROM_Pending_t;
+
+// Write-back cache of 8 byte blocks, see EEPROM_WriteDeferred()
+static EEPROM_Pending_t gEEPROM_Pending[EEPROM_CACHE_SIZE];
+static uint8_t gEEPROM_PendingCount;
+
+#if defined(ENABLE_PERF_STATS)
+EEPROM_Stats_t gEEPROM_Stats;
+#endif
+
+static void EEPROM_ReadBus(uint16_t Address, void *pBuffer, uint8_t Size)
 {
 	I2C_Start();
 	I2C_Write(0xA0);
@@ -33,24 +46,181 @@ void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
 	I2C_Stop();
 }
 
-void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer)
+void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
 {
-	// 1o11
-	// EEPROM wear reduction
-	// only write the data if it's different to what's already there
-	uint8_t Buf[8];
-	memset(Buf, 0, sizeof(Buf));
-	EEPROM_ReadBuffer(Address, Buf, 8);
-	if (memcmp(pBuffer, Buf, 8) == 0) {
-		return;
+	uint8_t *pData = (uint8_t *)pBuffer;
+	uint8_t i;
+
+	EEPROM_ReadBus(Address, pBuffer, Size);
+
+	// Blocks that are still waiting to be written win over the device
+	for (i = 0; i < gEEPROM_PendingCount; i++) {
+		const EEPROM_Pending_t *pPending = &gEEPROM_Pending[i];
+		uint16_t Start = pPending->Address;
+		uint16_t End = pPending->Address + 8;
+
+		if (Start < Address) {
+			Start = Address;
+		}
+		if (End > Address + Size) {
+			End = Address + Size;
+		}
+		if (Start < End) {
+			memcpy(pData + (Start - Address), pPending->Data + (Start - pPending->Address), End - Start);
+		}
 	}
-	I2C_Start();
-	I2C_Write(0xA0);
-	I2C_Write((Address >> 8) & 0xFF);
-	I2C_Write((Address >> 0) & 0xFF);
-	I2C_WriteBuffer(pBuffer, 8);
-	I2C_Stop();
+}
+
+// Acknowledge polling: the device ignores its address until the internal
+// write cycle has finished, so this returns as soon as it is done.
+static void EEPROM_WaitReady(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < EEPROM_WRITE_POLL_LIMIT; i++) {
+		bool bAck;
+
+		I2C_Start();
+		bAck = I2C_TryWrite(0xA0);
+		I2C_Stop();
+		if (bAck) {
+			return;
+		}
+#if defined(ENABLE_PERF_STATS)
+		gEEPROM_Stats.BusyPolls++;
+#endif
+	}
+
 	// https://www.st.com/resource/en/application_note/an5771-timing-of-erase-program-and-write-operations-for-page-eeproms-stmicroelectronics.pdf
 	SYSTEM_DelayMs(8);
 }
 
+static void EEPROM_WritePages(uint16_t Address, const void *pBuffer, uint16_t Size)
+{
+	const uint8_t *pData = (const uint8_t *)pBuffer;
+	uint8_t Buf[EEPROM_PAGE_SIZE];
+
+	while (Size > 0) {
+		// A page write wraps around inside the page, never cross a boundary
+		uint8_t Length = EEPROM_PAGE_SIZE - (Address % EEPROM_PAGE_SIZE);
+
+		if (Length > Size) {
+			Length = Size;
+		}
+
+		// 1o11
+		// EEPROM wear reduction
+		// only write the data if it's different to what's already there
+		EEPROM_ReadBus(Address, Buf, Length);
+		if (memcmp(pData, Buf, Length) != 0) {
+			I2C_Start();
+			I2C_Write(0xA0);
+			I2C_Write((Address >> 8) & 0xFF);
+			I2C_Write((Address >> 0) & 0xFF);
+			I2C_WriteBuffer(pData, Length);
+			I2C_Stop();
+			EEPROM_WaitReady();
+#if defined(ENABLE_PERF_STATS)
+			gEEPROM_Stats.PageWrites++;
+		} else {
+			gEEPROM_Stats.PagesSkipped++;
+#endif
+		}
+
+		Address += Length;
+		pData += Length;
+		Size -= Length;
+	}
+}
+
+void EEPROM_WriteBlock(uint16_t Address, const void *pBuffer, uint16_t Size)
+{
+	uint8_t i;
+
+	// Keep the order of writes to the same bytes
+	for (i = 0; i < gEEPROM_PendingCount; i++) {
+		if (gEEPROM_Pending[i].Address < Address + Size && Address < gEEPROM_Pending[i].Address + 8) {
+			EEPROM_Flush();
+			break;
+		}
+	}
+
+	EEPROM_WritePages(Address, pBuffer, Size);
+}
+
+void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer)
+{
+	EEPROM_WriteBlock(Address, pBuffer, 8);
+}
+
+void EEPROM_WriteDeferred(uint16_t Address, const void *pBuffer)
+{
+	uint8_t i;
+
+	if (Address % 8) {
+		EEPROM_WriteBlock(Address, pBuffer, 8);
+		return;
+	}
+
+	for (i = 0; i < gEEPROM_PendingCount; i++) {
+		if (gEEPROM_Pending[i].Address == Address) {
+			memcpy(gEEPROM_Pending[i].Data, pBuffer, 8);
+#if defined(ENABLE_PERF_STATS)
+			gEEPROM_Stats.Coalesced++;
+#endif
+			return;
+		}
+	}
+
+	if (gEEPROM_PendingCount == EEPROM_CACHE_SIZE) {
+		EEPROM_Flush();
+	}
+
+	gEEPROM_Pending[gEEPROM_PendingCount].Address = Address;
+	memcpy(gEEPROM_Pending[gEEPROM_PendingCount].Data, pBuffer, 8);
+	gEEPROM_PendingCount++;
+#if defined(ENABLE_PERF_STATS)
+	gEEPROM_Stats.Deferred++;
+#endif
+}
+
+bool EEPROM_HasPending(void)
+{
+	return gEEPROM_PendingCount > 0;
+}
+
+void EEPROM_Flush(void)
+{
+	uint8_t Buf[EEPROM_PAGE_SIZE];
+
+	// Gather every pending block of one page into a single page write
+	while (gEEPROM_PendingCount > 0) {
+		const uint16_t Base = gEEPROM_Pending[0].Address & ~(EEPROM_PAGE_SIZE - 1);
+		uint8_t Min = EEPROM_PAGE_SIZE;
+		uint8_t Max = 0;
+		uint8_t i;
+
+		EEPROM_ReadBus(Base, Buf, EEPROM_PAGE_SIZE);
+
+		i = 0;
+		while (i < gEEPROM_PendingCount) {
+			const EEPROM_Pending_t *pPending = &gEEPROM_Pending[i];
+			const uint8_t Offset = pPending->Address - Base;
+
+			if ((pPending->Address & ~(EEPROM_PAGE_SIZE - 1)) != Base) {
+				i++;
+				continue;
+			}
+			memcpy(Buf + Offset, pPending->Data, 8);
+			if (Min > Offset) {
+				Min = Offset;
+			}
+			if (Max < Offset + 8) {
+				Max = Offset + 8;
+			}
+			gEEPROM_Pending[i] = gEEPROM_Pending[--gEEPROM_PendingCount];
+		}
+
+		EEPROM_WritePages(Base + Min, Buf + Min, Max - Min);
+	}
+}
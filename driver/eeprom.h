@@ -17,10 +17,37 @@
 #ifndef DRIVER_EEPROM_H
 #define DRIVER_EEPROM_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
+// BL24C64, 8 KB in 32 byte pages
+#define EEPROM_SIZE      0x2000U
+#define EEPROM_PAGE_SIZE 32U
+
+// Each poll is one start, address byte and stop, about 60 us on this bus
+#define EEPROM_WRITE_POLL_LIMIT 200U
+
+// Number of 8 byte blocks EEPROM_WriteDeferred() can hold back
+#define EEPROM_CACHE_SIZE 16U
+
+#if defined(ENABLE_PERF_STATS)
+typedef struct {
+	uint32_t PageWrites;
+	uint32_t PagesSkipped;
+	uint32_t BusyPolls;
+	uint32_t Deferred;
+	uint32_t Coalesced;
+} EEPROM_Stats_t;
+
+extern EEPROM_Stats_t gEEPROM_Stats;
+#endif
+
 void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size);
+void EEPROM_WriteBlock(uint16_t Address, const void *pBuffer, uint16_t Size);
 void EEPROM_WriteBuffer(uint16_t Address, const void *pBuffer);
+void EEPROM_WriteDeferred(uint16_t Address, const void *pBuffer);
+bool EEPROM_HasPending(void);
+void EEPROM_Flush(void);
 
 #endif
 
@@ -14,12 +14,29 @@
  *     limitations under the License.
  */
 
+#if defined(ENABLE_DISPLAY_DMA)
+#include "ARMCM0.h"
+#endif
 #include "driver/gpio.h"
 #include "systick.h"
 
+// With ENABLE_DISPLAY_DMA the DMA handler drives ST7565 A0 on GPIOB while
+// the main loop drives the backlight and BK1080 on the same port, so each
+// read-modify-write is done with interrupts masked. PRIMASK is restored
+// rather than cleared because some callers already run with interrupts
+// masked. Without it no handler touches GPIO and the bus edges stay bare.
+
 void GPIO_ClearBit(volatile uint32_t *pReg, uint8_t Bit)
 {
+#if defined(ENABLE_DISPLAY_DMA)
+	const uint32_t Primask = __get_PRIMASK();
+
+	__disable_irq();
+#endif
 	*pReg &= ~(1U << Bit);
+#if defined(ENABLE_DISPLAY_DMA)
+	__set_PRIMASK(Primask);
+#endif
 	SYSTICK_DelayUs(2);
 }
 
@@ -31,13 +48,29 @@ uint8_t GPIO_CheckBit(volatile uint32_t *pReg, uint8_t Bit)
 
 void GPIO_FlipBit(volatile uint32_t *pReg, uint8_t Bit)
 {
+#if defined(ENABLE_DISPLAY_DMA)
+	const uint32_t Primask = __get_PRIMASK();
+
+	__disable_irq();
+#endif
 	*pReg ^= 1U << Bit;
+#if defined(ENABLE_DISPLAY_DMA)
+	__set_PRIMASK(Primask);
+#endif
 	SYSTICK_DelayUs(2);
 }
 
 void GPIO_SetBit(volatile uint32_t *pReg, uint8_t Bit)
 {
+#if defined(ENABLE_DISPLAY_DMA)
+	const uint32_t Primask = __get_PRIMASK();
+
+	__disable_irq();
+#endif
 	*pReg |= 1U << Bit;
+#if defined(ENABLE_DISPLAY_DMA)
+	__set_PRIMASK(Primask);
+#endif
 	SYSTICK_DelayUs(2);
 }
 
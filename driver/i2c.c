@@ -74,9 +74,10 @@ uint8_t I2C_Read(bool bFinal)
 	return Data;
 }
 
-bool I2C_Write(uint8_t Data)
+static bool I2C_Send(uint8_t Data, bool bWaitForAck)
 {
 	uint8_t i;
+	bool bAck;
 
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
 
@@ -99,9 +100,10 @@ bool I2C_Write(uint8_t Data)
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
 
-	while (GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA)) {
+	while (bWaitForAck && GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA)) {
 		// Spinlock until we are ready
 	}
+	bAck = !GPIO_CheckBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 	GPIO_ClearBit(&GPIOA->DATA, GPIOA_PIN_I2C_SCL);
 
 	PORTCON_PORTA_IE &= ~PORTCON_PORTA_IE_A11_MASK;
@@ -109,9 +111,22 @@ bool I2C_Write(uint8_t Data)
 	GPIOA->DIR |= GPIO_DIR_11_BITS_OUTPUT;
 	GPIO_SetBit(&GPIOA->DATA, GPIOA_PIN_I2C_SDA);
 
+	return bAck;
+}
+
+bool I2C_Write(uint8_t Data)
+{
+	I2C_Send(Data, true);
+
 	return false;
 }
 
+// Single attempt, returns true if the device acknowledged the byte
+bool I2C_TryWrite(uint8_t Data)
+{
+	return I2C_Send(Data, false);
+}
+
 __attribute__((used)) int I2C_ReadBuffer(void *pBuffer, uint8_t Size)
 {
 	uint8_t *pData = (uint8_t *)pBuffer;
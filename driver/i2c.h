@@ -30,6 +30,7 @@ void I2C_Stop(void);
 
 uint8_t I2C_Read(bool bFinal);
 bool I2C_Write(uint8_t Data);
+bool I2C_TryWrite(uint8_t Data);
 
 int I2C_ReadBuffer(void *pBuffer, uint8_t Size);
 bool I2C_WriteBuffer(const void *pBuffer, uint8_t Size);
@@ -15,19 +15,241 @@
  */
 
 #include <stdint.h>
+#include <string.h>
+#if defined(ENABLE_DISPLAY_DMA)
+#include "ARMCM0.h"
+#endif
+#if defined(ENABLE_PERF_STATS)
+#include "board.h"
+#endif
+#if defined(ENABLE_DISPLAY_DMA)
+#include "bsp/dp32g030/dma.h"
+#endif
 #include "bsp/dp32g030/gpio.h"
+#if defined(ENABLE_DISPLAY_DMA)
+#include "bsp/dp32g030/irq.h"
+#endif
 #include "bsp/dp32g030/spi.h"
 #include "driver/gpio.h"
 #include "driver/spi.h"
 #include "driver/st7565.h"
+#if defined(ENABLE_PERF_STATS)
+#include "scheduler.h"
+#endif
 
 //#define ARRAY_SIZE(x) (sizeof(x) / sizeof(x[0]))
 
+#if defined(ENABLE_DISPLAY_DMA)
+// Handshake line of the SPI0 TX FIFO, UART1 RX being HSREQ_MS1
+#ifndef ST7565_DMA_HSREQ
+#define ST7565_DMA_HSREQ DMA_CH_MOD_MD_SEL_BITS_HSREQ_MS4
+#endif
+#endif
+
 uint8_t gStatusLine[128];
 uint8_t gFrameBuffer[7][128];
 
+#if defined(ENABLE_PERF_STATS)
+ST7565_Stats_t gST7565_Stats;
+#endif
+
+// What the panel shows, page 0 being the status line. Blits only send the
+// span of a page that differs from it. Stale pages are sent in full.
+static uint8_t gShadow[8][128];
+static uint8_t gStalePages = 0xFF;
+
+// Finds the columns of a page that differ from the shadow and copies them
+// over. Returns false if the page is unchanged.
+static bool UpdateShadow(uint8_t Page, const uint8_t *pLine, uint8_t *pFirst, uint8_t *pLast)
+{
+	uint8_t *pShadow = gShadow[Page];
+	uint8_t First = 0;
+	uint8_t Last = 127;
+
+	if ((gStalePages & (1U << Page)) == 0) {
+		while (First < 128 && pLine[First] == pShadow[First]) {
+			First++;
+		}
+		if (First == 128) {
+#if defined(ENABLE_PERF_STATS)
+			gST7565_Stats.PagesSkipped++;
+#endif
+			return false;
+		}
+		while (pLine[Last] == pShadow[Last]) {
+			Last--;
+		}
+	}
+	gStalePages &= ~(1U << Page);
+
+	memcpy(&pShadow[First], &pLine[First], Last + 1U - First);
+	*pFirst = First;
+	*pLast = Last;
+
+	return true;
+}
+
+#if defined(ENABLE_DISPLAY_DMA)
+// Column span still to be sent for each page in gQueuedPages. The channel
+// reads straight from the shadow, so a page that changes again while it
+// is on the wire is simply queued once more.
+static uint8_t gSpanFirst[8];
+static uint8_t gSpanLast[8];
+static volatile uint8_t gQueuedPages;
+static volatile bool gDmaBusy;
+
+static void QueueSpan(uint8_t Page, uint8_t First, uint8_t Last)
+{
+	__disable_irq();
+	if (gQueuedPages & (1U << Page)) {
+		if (First < gSpanFirst[Page]) {
+			gSpanFirst[Page] = First;
+		}
+		if (Last > gSpanLast[Page]) {
+			gSpanLast[Page] = Last;
+		}
+	} else {
+		gSpanFirst[Page] = First;
+		gSpanLast[Page] = Last;
+		gQueuedPages |= 1U << Page;
+	}
+	__enable_irq();
+}
+
+// Called with interrupts masked or from the DMA handler
+static void StartPage(void)
+{
+	uint8_t Page = 0;
+
+	while ((gQueuedPages & (1U << Page)) == 0) {
+		Page++;
+	}
+	gQueuedPages &= ~(1U << Page);
+
+	const uint8_t First = gSpanFirst[Page];
+	const uint8_t Last = gSpanLast[Page];
+
+	ST7565_SelectColumnAndLine(First + 4U, Page);
+	SPI_WaitForUndocumentedTxFifoStatusBit();
+	GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
+
+	DMA_CH1->CTR = 0;
+	DMA_CH1->MSADDR = (uint32_t)(uintptr_t)&gShadow[Page][First];
+	DMA_CH1->MDADDR = (uint32_t)(uintptr_t)&SPI0->WDR;
+	DMA_CH1->MOD = 0
+		// Source
+		| DMA_CH_MOD_MS_ADDMOD_BITS_INCREMENT
+		| DMA_CH_MOD_MS_SIZE_BITS_8BIT
+		| DMA_CH_MOD_MS_SEL_BITS_SRAM
+		// Destination
+		| DMA_CH_MOD_MD_ADDMOD_BITS_NONE
+		| DMA_CH_MOD_MD_SIZE_BITS_8BIT
+		| ST7565_DMA_HSREQ
+		;
+	DMA_INTEN |= DMA_INTEN_CH1_TC_INTEN_BITS_ENABLE;
+	DMA_CH1->CTR = 0
+		| DMA_CH_CTR_CH_EN_BITS_ENABLE
+		| (((uint32_t)(Last - First) << DMA_CH_CTR_LENGTH_SHIFT) & DMA_CH_CTR_LENGTH_MASK)
+		| DMA_CH_CTR_LOOP_BITS_DISABLE
+		| DMA_CH_CTR_PRI_BITS_LOW
+		;
+
+#if defined(ENABLE_PERF_STATS)
+	gST7565_Stats.PagesSent++;
+	gST7565_Stats.DataBytes += Last + 1U - First;
+	gST7565_Stats.CommandBytes += 3;
+#endif
+}
+
+static void StartQueue(void)
+{
+	__disable_irq();
+	if (!gDmaBusy && gQueuedPages) {
+		gDmaBusy = true;
+		SPI_DisableMasterMode(&SPI0->CR);
+		ST7565_WriteByte(0x40);
+#if defined(ENABLE_PERF_STATS)
+		gST7565_Stats.CommandBytes++;
+#endif
+		StartPage();
+	}
+	__enable_irq();
+}
+
+void HandlerDMA(void);
+
+void HandlerDMA(void)
+{
+#if defined(ENABLE_PERF_STATS)
+	const uint32_t Start = SCHEDULER_GetTimeUs();
+#endif
+
+	if ((DMA_INTST & DMA_INTST_CH1_TC_INTST_MASK) == 0) {
+		return;
+	}
+	DMA_INTST = DMA_INTST_CH1_TC_INTST_BITS_SET;
+
+	// The tail of the page is still in the TX FIFO
+	SPI_WaitForUndocumentedTxFifoStatusBit();
+
+	if (gQueuedPages) {
+		StartPage();
+	} else {
+		SPI_EnableMasterMode(&SPI0->CR);
+		gDmaBusy = false;
+	}
+
+#if defined(ENABLE_PERF_STATS)
+	gST7565_Stats.BlockedUs += SCHEDULER_GetTimeUs() - Start;
+#endif
+}
+#else
+static void BlitPage(uint8_t Page, const uint8_t *pLine)
+{
+	uint8_t First;
+	uint8_t Last;
+	uint8_t Column;
+
+	if (!UpdateShadow(Page, pLine, &First, &Last)) {
+		return;
+	}
+
+	ST7565_SelectColumnAndLine(First + 4U, Page);
+	SPI_WaitForUndocumentedTxFifoStatusBit();
+
+	GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
+	for (Column = First; Column <= Last; Column++) {
+		while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {
+		}
+		SPI0->WDR = pLine[Column];
+	}
+	SPI_WaitForUndocumentedTxFifoStatusBit();
+
+#if defined(ENABLE_PERF_STATS)
+	gST7565_Stats.PagesSent++;
+	gST7565_Stats.DataBytes += Last + 1U - First;
+	gST7565_Stats.CommandBytes += 3;
+#endif
+}
+#endif
+
 void ST7565_DrawLine(uint8_t Column, uint8_t Line, uint16_t Size, const uint8_t *pBitmap, bool bIsClearMode)
 {
+	if (!bIsClearMode) {
+		memcpy(&gShadow[Line][Column], pBitmap, Size);
+	} else {
+		memset(&gShadow[Line][Column], 0, Size);
+	}
+
+#if defined(ENABLE_DISPLAY_DMA)
+	// Sent from the shadow like any other span
+	QueueSpan(Line, Column, Column + Size - 1U);
+	StartQueue();
+#else
+#if defined(ENABLE_PERF_STATS)
+	const uint32_t Start = SCHEDULER_GetTimeUs();
+#endif
+
 	SPI_DisableMasterMode(&SPI0->CR);
 	ST7565_SelectColumnAndLine(Column + 4U, Line);
 	SPI_WaitForUndocumentedTxFifoStatusBit();
@@ -50,54 +272,94 @@ void ST7565_DrawLine(uint8_t Column, uint8_t Line, uint16_t Size, const uint8_t
 
 	SPI_WaitForUndocumentedTxFifoStatusBit();
 	SPI_EnableMasterMode(&SPI0->CR);
+
+#if defined(ENABLE_PERF_STATS)
+	gST7565_Stats.BlockedUs += SCHEDULER_GetTimeUs() - Start;
+#endif
+#endif
 }
 
 void ST7565_BlitFullScreen(void)
 {
-	SPI_DisableMasterMode(&SPI0->CR);
-	ST7565_WriteByte(0x40);
+#if defined(ENABLE_PERF_STATS)
+	// Time from SysTick start to the first full frame
+	if (gBootStats.FirstBlitUs == 0) {
+		gBootStats.FirstBlitUs = SCHEDULER_GetTimeUs();
+	}
+#endif
+
+#if defined(ENABLE_PERF_STATS)
+	const uint32_t Start = SCHEDULER_GetTimeUs();
+
+	gST7565_Stats.Blits++;
+#endif
 
 	uint8_t Line; // ARRAY_SIZE(gFrameBuffer)
-	uint8_t Column; // ARRAY_SIZE(gFrameBuffer[0])
-	for (Line = 0; Line < 7; Line++) {
-		ST7565_SelectColumnAndLine(4U, Line + 1U);
-		SPI_WaitForUndocumentedTxFifoStatusBit();
+#if defined(ENABLE_DISPLAY_DMA)
+	uint8_t First;
+	uint8_t Last;
 
-		GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
-		for (Column = 0; Column < 128; Column++) {
-			while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {
-			}
-			SPI0->WDR = gFrameBuffer[Line][Column];
+	for (Line = 0; Line < 7; Line++) {
+		if (UpdateShadow(Line + 1U, gFrameBuffer[Line], &First, &Last)) {
+			QueueSpan(Line + 1U, First, Last);
 		}
-		SPI_WaitForUndocumentedTxFifoStatusBit();
+	}
+	StartQueue();
+#else
+	SPI_DisableMasterMode(&SPI0->CR);
+	ST7565_WriteByte(0x40);
+#if defined(ENABLE_PERF_STATS)
+	gST7565_Stats.CommandBytes++;
+#endif
+
+	for (Line = 0; Line < 7; Line++) {
+		BlitPage(Line + 1U, gFrameBuffer[Line]);
 	}
 
 	SPI_EnableMasterMode(&SPI0->CR);
+#endif
+
+#if defined(ENABLE_PERF_STATS)
+	gST7565_Stats.BlockedUs += SCHEDULER_GetTimeUs() - Start;
+#endif
 }
 
 void ST7565_BlitStatusLine(void)
 {
-	SPI_DisableMasterMode(&SPI0->CR);
-	ST7565_WriteByte(0x40);
+#if defined(ENABLE_PERF_STATS)
+	const uint32_t Start = SCHEDULER_GetTimeUs();
 
-	ST7565_SelectColumnAndLine(4U, 0U);
-	SPI_WaitForUndocumentedTxFifoStatusBit();
+	gST7565_Stats.Blits++;
+#endif
 
-	GPIO_SetBit(&GPIOB->DATA, GPIOB_PIN_ST7565_A0);
-	for (uint8_t Column = 0; Column < 128; Column++) {
-		while ((SPI0->FIFOST & SPI_FIFOST_TFF_MASK) != SPI_FIFOST_TFF_BITS_NOT_FULL) {
-		}
-		SPI0->WDR = gStatusLine[Column];
-	}
-	SPI_WaitForUndocumentedTxFifoStatusBit();
+#if defined(ENABLE_DISPLAY_DMA)
+	uint8_t First;
+	uint8_t Last;
 
+	if (UpdateShadow(0, gStatusLine, &First, &Last)) {
+		QueueSpan(0, First, Last);
+		StartQueue();
+	}
+#else
+	SPI_DisableMasterMode(&SPI0->CR);
+	ST7565_WriteByte(0x40);
+#if defined(ENABLE_PERF_STATS)
+	gST7565_Stats.CommandBytes++;
+#endif
+	BlitPage(0, gStatusLine);
 	SPI_EnableMasterMode(&SPI0->CR);
+#endif
+
+#if defined(ENABLE_PERF_STATS)
+	gST7565_Stats.BlockedUs += SCHEDULER_GetTimeUs() - Start;
+#endif
 }
 
 void ST7565_Init(void)
 {
 	SPI0_Init();
 	ST7565_HardwareReset();
+	gStalePages = 0xFF;
 	SPI_DisableMasterMode(&SPI0->CR);
 
 	ST7565_WriteByte(0xE2);
@@ -120,6 +382,13 @@ void ST7565_Init(void)
 
 	SPI_WaitForUndocumentedTxFifoStatusBit();
 	SPI_EnableMasterMode(&SPI0->CR);
+
+#if defined(ENABLE_DISPLAY_DMA)
+	// Blits use DMA channel 1, channel 0 belongs to the UART
+	SPI0->CR |= SPI_CR_TXDMAEN_MASK;
+	DMA_CTR = (DMA_CTR & ~DMA_CTR_DMAEN_MASK) | DMA_CTR_DMAEN_BITS_ENABLE;
+	NVIC_EnableIRQ((IRQn_Type)DP32_DMA_IRQn);
+#endif
 	//SPI1_Init();
 }
 
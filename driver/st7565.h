@@ -20,6 +20,19 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#if defined(ENABLE_PERF_STATS)
+typedef struct {
+	uint32_t Blits;
+	uint32_t PagesSent;
+	uint32_t PagesSkipped;
+	uint32_t DataBytes;
+	uint32_t CommandBytes;
+	uint32_t BlockedUs;
+} ST7565_Stats_t;
+
+extern ST7565_Stats_t gST7565_Stats;
+#endif
+
 extern uint8_t gStatusLine[128];
 extern uint8_t gFrameBuffer[7][128];
 
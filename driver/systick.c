@@ -23,7 +23,7 @@ static uint32_t gTickMultiplier;
 
 void SYSTICK_Init(void)
 {
-	SysTick_Config(480000);
+	SysTick_Config(SYSTICK_TICK_CYCLES);
 	gTickMultiplier = 48;
 }
 
@@ -52,3 +52,16 @@ void SYSTICK_DelayUs(uint32_t Delay)
 	} while (i < Delay * gTickMultiplier);
 }
 
+// Cycles since Start was read from SysTick->VAL, for spans shorter than one
+// tick. SysTick counts down and reloads from LOAD.
+uint32_t SYSTICK_ElapsedCycles(uint32_t Start)
+{
+	const uint32_t Now = SysTick->VAL;
+
+	if (Now <= Start) {
+		return Start - Now;
+	}
+
+	return Start + SysTick->LOAD + 1 - Now;
+}
+
@@ -19,8 +19,12 @@
 
 #include <stdint.h>
 
+// One 10 ms scheduler tick at 48 MHz
+#define SYSTICK_TICK_CYCLES 480000U
+
 void SYSTICK_Init(void);
 void SYSTICK_DelayUs(uint32_t Delay);
+uint32_t SYSTICK_ElapsedCycles(uint32_t Start);
 
 #endif
 
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+
+# Downloads the EEPROM over the programming cable with the streaming read
+# command (0x054F). The radio pushes 128 byte blocks back to back, each with
+# its own CRC. A block that fails its CRC or goes missing is fetched again by
+# restarting the stream at the first offset not received yet.
+# tests/streamread.c runs the same loop against app/uart.c on the host.
+#
+# Usage: eeprom-read.py <port> <output> [offset] [length]
+
+import crcmod
+import serial
+import struct
+import sys
+import time
+
+EEPROM_SIZE = 0x2000
+
+crc16 = crcmod.predefined.mkCrcFun('xmodem')
+
+def send(port, payload):
+    # A plain 0x0514 switches the session off obfuscation, the rest follows
+    port.write(b'\xab\xcd' + struct.pack('<H', len(payload)) + payload + struct.pack('<H', crc16(payload)) + b'\xdc\xba')
+
+def receive(port):
+    while True:
+        byte = port.read(1)
+        if not byte:
+            return None
+        if byte == b'\xab' and port.read(1) == b'\xcd':
+            break
+
+    header = port.read(2)
+    if len(header) != 2:
+        return None
+    size = struct.unpack('<H', header)[0]
+    frame = port.read(size + 4)
+    if len(frame) != size + 4 or frame[-2:] != b'\xdc\xba':
+        return None
+
+    return frame[:size]
+
+def request(port, timestamp, offset, length):
+    send(port, struct.pack('<HHHHI', 0x054F, 8, offset, length, timestamp))
+    return offset
+
+if len(sys.argv) < 3:
+    print('Usage: eeprom-read.py <port> <output> [offset] [length]')
+    sys.exit(1)
+
+offset = int(sys.argv[3], 0) if len(sys.argv) > 3 else 0
+length = int(sys.argv[4], 0) if len(sys.argv) > 4 else EEPROM_SIZE - offset
+end = offset + length
+
+port = serial.Serial(sys.argv[1], 38400, timeout=0.5)
+timestamp = int(time.time()) & 0xFFFFFFFF
+
+send(port, struct.pack('<HHI', 0x0514, 4, timestamp))
+while True:
+    payload = receive(port)
+    if payload is None:
+        print('No reply from the radio')
+        sys.exit(1)
+    if struct.unpack_from('<H', payload)[0] == 0x0515:
+        print('Radio: %s' % payload[4:20].split(b'\x00')[0].decode('ascii', 'replace'))
+        break
+
+data = bytearray(length)
+position = offset
+retries = 0
+start = time.time()
+requested = request(port, timestamp, position, end - position)
+
+while position < end:
+    payload = receive(port)
+    if payload is None:
+        retries += 1
+        requested = request(port, timestamp, position, end - position)
+        continue
+    if struct.unpack_from('<H', payload)[0] != 0x0550:
+        continue
+
+    block_offset, size, _, remaining, crc = struct.unpack_from('<HBBHH', payload, 4)
+    block = payload[12:12 + size]
+    if size == 0:
+        print('The radio refused the read, is it locked?')
+        sys.exit(1)
+
+    if block_offset == position and len(block) == size and crc16(block) == crc:
+        data[position - offset:position - offset + size] = block
+        position += size
+    elif requested != position:
+        # Blocks of the stream we gave up on keep coming until the radio
+        # sees the new request, only ask once
+        retries += 1
+        requested = request(port, timestamp, position, end - position)
+
+elapsed = time.time() - start
+open(sys.argv[2], 'wb').write(data)
+print('%d bytes in %.2f s, %d B/s, %d retries' % (length, elapsed, length / elapsed, retries))
@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+
+# Uploads an EEPROM image over the programming cable with the bulk write
+# command (0x0551). The radio acknowledges a block before it programs it,
+# so the next block is already on the wire while the pages are written.
+# A block that is not acknowledged in time is sent again.
+# tests/bulkwrite.c runs the same loop against app/uart.c on the host.
+#
+# Usage: eeprom-write.py <port> <input> [offset]
+
+import crcmod
+import serial
+import struct
+import sys
+import time
+
+EEPROM_SIZE = 0x2000
+BLOCK_SIZE = 128
+
+crc16 = crcmod.predefined.mkCrcFun('xmodem')
+
+def send(port, payload):
+    # A plain 0x0514 switches the session off obfuscation, the rest follows
+    port.write(b'\xab\xcd' + struct.pack('<H', len(payload)) + payload + struct.pack('<H', crc16(payload)) + b'\xdc\xba')
+
+def receive(port):
+    while True:
+        byte = port.read(1)
+        if not byte:
+            return None
+        if byte == b'\xab' and port.read(1) == b'\xcd':
+            break
+
+    header = port.read(2)
+    if len(header) != 2:
+        return None
+    size = struct.unpack('<H', header)[0]
+    frame = port.read(size + 4)
+    if len(frame) != size + 4 or frame[-2:] != b'\xdc\xba':
+        return None
+
+    return frame[:size]
+
+if len(sys.argv) < 3:
+    print('Usage: eeprom-write.py <port> <input> [offset]')
+    sys.exit(1)
+
+data = open(sys.argv[2], 'rb').read()
+offset = int(sys.argv[3], 0) if len(sys.argv) > 3 else 0
+if offset + len(data) > EEPROM_SIZE:
+    print('The image does not fit in the EEPROM')
+    sys.exit(1)
+
+port = serial.Serial(sys.argv[1], 38400, timeout=0.5)
+timestamp = int(time.time()) & 0xFFFFFFFF
+
+send(port, struct.pack('<HHI', 0x0514, 4, timestamp))
+while True:
+    payload = receive(port)
+    if payload is None:
+        print('No reply from the radio')
+        sys.exit(1)
+    if struct.unpack_from('<H', payload)[0] == 0x0515:
+        print('Radio: %s' % payload[4:20].split(b'\x00')[0].decode('ascii', 'replace'))
+        break
+
+position = 0
+retries = 0
+start = time.time()
+
+while position < len(data):
+    block = data[position:position + BLOCK_SIZE]
+    address = offset + position
+    send(port, struct.pack('<HHHB?I', 0x0551, 8 + len(block), address, len(block), False, timestamp) + block)
+
+    while True:
+        payload = receive(port)
+        if payload is None:
+            retries += 1
+            break
+        if struct.unpack_from('<H', payload)[0] != 0x0552:
+            continue
+        ack_offset, ack_size = struct.unpack_from('<HB', payload, 4)
+        if ack_offset != address:
+            continue
+        if ack_size == 0:
+            print('The radio refused the write at 0x%04X, is it locked?' % address)
+            sys.exit(1)
+        position += len(block)
+        break
+
+# The last block is still being programmed, wait for the radio to take a command
+send(port, struct.pack('<HHI', 0x0514, 4, timestamp))
+receive(port)
+
+elapsed = time.time() - start
+print('%d bytes in %.2f s, %d B/s, %d retries' % (len(data), elapsed, len(data) / elapsed, retries))
@@ -17,116 +17,150 @@
 
 #include "font.h"
 
-const uint8_t gFontBig[95][15] = {                                                               // 1o11
-	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // ' '
-	{0x00, 0x00, 0x70, 0xF8, 0xF8, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1B, 0x00, 0x00}, // !
-	{0x00, 0x1E, 0x3E, 0x00, 0x00, 0x3E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // "
-	{0x40, 0xF0, 0xF0, 0x40, 0xF0, 0xF0, 0x40, 0x00, 0x04, 0x1F, 0x1F, 0x04, 0x1F, 0x1F, 0x04}, // #
-	{0x70, 0xF8, 0x88, 0x8F, 0x8F, 0x98, 0x30, 0x00, 0x06, 0x0C, 0x08, 0x38, 0x38, 0x0F, 0x07}, // $
-	{0x60, 0x60, 0x00, 0x00, 0x80, 0xC0, 0x60, 0x00, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x18, 0x18}, // %
-	{0x00, 0xB0, 0xF8, 0xC8, 0x78, 0xB0, 0x80, 0x00, 0x0F, 0x1F, 0x10, 0x11, 0x0F, 0x1F, 0x10}, // &
-	{0x00, 0x20, 0x3E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // '
-	{0x00, 0x00, 0xE0, 0xF0, 0x18, 0x08, 0x00, 0x00, 0x00, 0x00, 0x07, 0x0F, 0x18, 0x10, 0x00}, // (
-	{0x00, 0x00, 0x08, 0x18, 0xF0, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x10, 0x18, 0x0F, 0x07, 0x00}, // )
-	{0x00, 0x40, 0xC0, 0x80, 0x80, 0xC0, 0x40, 0x00, 0x01, 0x05, 0x07, 0x03, 0x03, 0x07, 0x05}, // *
-	{0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x07, 0x07, 0x01, 0x01}, // +
-	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x3C, 0x1C, 0x00, 0x00}, // ,
-	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01}, // -
-	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00}, // .
-	{0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0x60, 0x00, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00, 0x00}, // /
-	{0xF0, 0xF8, 0x08, 0x88, 0x48, 0xF8, 0xF0, 0x00, 0x0F, 0x1F, 0x12, 0x11, 0x10, 0x1F, 0x0F}, // 0
-	{0x00, 0x20, 0x30, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x1F, 0x10, 0x10}, // 1
-	{0x10, 0x18, 0x08, 0x88, 0xC8, 0x78, 0x30, 0x00, 0x1C, 0x1E, 0x13, 0x11, 0x10, 0x18, 0x18}, // 2
-	{0x10, 0x18, 0x88, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x08, 0x18, 0x10, 0x10, 0x10, 0x1F, 0x0F}, // 3
-	{0x80, 0xC0, 0x60, 0x30, 0xF8, 0xF8, 0x00, 0x00, 0x01, 0x01, 0x01, 0x11, 0x1F, 0x1F, 0x11}, // 4
-	{0xF8, 0xF8, 0x88, 0x88, 0x88, 0x88, 0x08, 0x00, 0x08, 0x18, 0x10, 0x10, 0x11, 0x1F, 0x0F}, // 5
-	{0xE0, 0xF0, 0x98, 0x88, 0x88, 0x80, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x1F, 0x0F}, // 6
-	{0x18, 0x18, 0x08, 0x08, 0x88, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x1E, 0x1F, 0x01, 0x00, 0x00}, // 7
-	{0x70, 0xF8, 0x88, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x1F, 0x0F}, // 8
-	{0x70, 0xF8, 0x88, 0x88, 0x88, 0xF8, 0xF0, 0x00, 0x00, 0x10, 0x10, 0x10, 0x18, 0x0F, 0x07}, // 9
-	{0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00, 0x00}, // :
-	{0x00, 0x00, 0x00, 0x60, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1C, 0x0C, 0x00, 0x00}, // ;
-	{0x00, 0x00, 0x80, 0xC0, 0x60, 0x30, 0x10, 0x00, 0x00, 0x01, 0x03, 0x06, 0x0C, 0x18, 0x10}, // <
-	{0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04}, // =
-	{0x00, 0x10, 0x30, 0x60, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x10, 0x18, 0x0C, 0x06, 0x03, 0x01}, // >
-	{0x30, 0x38, 0x08, 0x88, 0xC8, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x1B, 0x1B, 0x00, 0x00}, // ?
-	{0xE0, 0xF0, 0x10, 0x90, 0x90, 0xF0, 0xE0, 0x00, 0x0F, 0x1F, 0x10, 0x17, 0x17, 0x17, 0x03}, // @
-	{0xC0, 0xE0, 0x30, 0x18, 0x30, 0xE0, 0xC0, 0x00, 0x1F, 0x1F, 0x01, 0x01, 0x01, 0x1F, 0x1F}, // A
-	{0x08, 0xF8, 0xF8, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x1F, 0x0F}, // B
-	{0xE0, 0xF0, 0x18, 0x08, 0x08, 0x18, 0x30, 0x00, 0x07, 0x0F, 0x18, 0x10, 0x10, 0x18, 0x0C}, // C
-	{0x08, 0xF8, 0xF8, 0x08, 0x18, 0xF0, 0xE0, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x18, 0x0F, 0x07}, // D
-	{0x08, 0xF8, 0xF8, 0x88, 0xC8, 0x18, 0x38, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x11, 0x18, 0x1C}, // E
-	{0x08, 0xF8, 0xF8, 0x88, 0xC8, 0x18, 0x38, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x01, 0x00, 0x00}, // F
-	{0xE0, 0xF0, 0x18, 0x08, 0x08, 0x18, 0x30, 0x00, 0x07, 0x0F, 0x18, 0x11, 0x11, 0x0F, 0x1F}, // G
-	{0xF8, 0xF8, 0x80, 0x80, 0x80, 0xF8, 0xF8, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F}, // H
-	{0x00, 0x00, 0x08, 0xF8, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00}, // I
-	{0x00, 0x00, 0x00, 0x08, 0xF8, 0xF8, 0x08, 0x00, 0x0E, 0x1E, 0x10, 0x10, 0x1F, 0x0F, 0x00}, // J
-	{0x08, 0xF8, 0xF8, 0x80, 0xE0, 0x78, 0x18, 0x00, 0x10, 0x1F, 0x1F, 0x01, 0x03, 0x1E, 0x1C}, // K
-	{0x08, 0xF8, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x10, 0x18, 0x1C}, // L
-	{0xF8, 0xF8, 0x70, 0xE0, 0x70, 0xF8, 0xF8, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x1F, 0x1F}, // M
-	{0xF8, 0xF8, 0x70, 0xE0, 0xC0, 0xF8, 0xF8, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x01, 0x1F, 0x1F}, // N
-	{0xE0, 0xF0, 0x18, 0x08, 0x18, 0xF0, 0xE0, 0x00, 0x07, 0x0F, 0x18, 0x10, 0x18, 0x0F, 0x07}, // O
-	{0x08, 0xF8, 0xF8, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00}, // P
-	{0xF0, 0xF8, 0x08, 0x08, 0x08, 0xF8, 0xF0, 0x00, 0x0F, 0x1F, 0x10, 0x1C, 0x78, 0x7F, 0x4F}, // Q
-	{0x08, 0xF8, 0xF8, 0x88, 0x88, 0xF8, 0x70, 0x00, 0x10, 0x1F, 0x1F, 0x00, 0x01, 0x1F, 0x1E}, // R
-	{0x30, 0x78, 0xC8, 0x88, 0x88, 0x38, 0x30, 0x00, 0x0C, 0x1C, 0x10, 0x10, 0x11, 0x1F, 0x0E}, // S
-	{0x00, 0x38, 0x18, 0xF8, 0xF8, 0x18, 0x38, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00}, // T
-	{0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x1F, 0x0F}, // U
-	{0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x03, 0x07, 0x0C, 0x18, 0x0C, 0x07, 0x03}, // V
-	{0xF8, 0xF8, 0x00, 0x00, 0x00, 0xF8, 0xF8, 0x00, 0x07, 0x1F, 0x1C, 0x07, 0x1C, 0x1F, 0x07}, // W
-	{0x18, 0x78, 0xE0, 0x80, 0xE0, 0x78, 0x18, 0x00, 0x18, 0x1E, 0x07, 0x01, 0x07, 0x1E, 0x18}, // X
-	{0x00, 0x78, 0xF8, 0x80, 0x80, 0xF8, 0x78, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00}, // Y
-	{0x38, 0x18, 0x08, 0x88, 0xC8, 0x78, 0x38, 0x00, 0x1C, 0x1E, 0x13, 0x11, 0x10, 0x18, 0x1C}, // Z
-	{0x00, 0x00, 0xF8, 0xF8, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x10, 0x10, 0x00}, // [
-	{0x70, 0xE0, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0E, 0x1C}, // "\"
-	{0x00, 0x00, 0x08, 0x08, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x1F, 0x00}, // ]
-	{0x10, 0x18, 0x0E, 0x07, 0x0E, 0x18, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // ^
-	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40}, // _
-	{0x00, 0x00, 0x07, 0x0F, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // `
-	{0x00, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x0E, 0x1F, 0x11, 0x11, 0x0F, 0x1F, 0x10}, // a
-	{0x08, 0xF8, 0xF8, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x10, 0x1F, 0x0F, 0x10, 0x10, 0x1F, 0x0F}, // b
-	{0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x18, 0x08}, // c
-	{0x00, 0x80, 0xC0, 0x48, 0xF8, 0xF8, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x0F, 0x1F, 0x10}, // d
-	{0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x0F, 0x1F, 0x11, 0x11, 0x11, 0x19, 0x09}, // e
-	{0x80, 0xF0, 0xF8, 0x88, 0x18, 0x30, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x00}, // f
-	{0x80, 0xC0, 0x40, 0x40, 0x80, 0xC0, 0x40, 0x00, 0x4F, 0xDF, 0x90, 0x90, 0xFF, 0x7F, 0x00}, // g
-	{0x08, 0xF8, 0xF8, 0x80, 0x40, 0xC0, 0x80, 0x00, 0x10, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F}, // h
-	{0x00, 0x00, 0x40, 0xD8, 0xD8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00}, // i
-	{0x00, 0x00, 0x00, 0x00, 0x40, 0xD8, 0xD8, 0x00, 0x00, 0x60, 0xE0, 0x80, 0x80, 0xFF, 0x7F}, // j
-	{0x08, 0xF8, 0xF8, 0x00, 0x80, 0xC0, 0x40, 0x00, 0x10, 0x1F, 0x1F, 0x03, 0x07, 0x1C, 0x18}, // k
-	{0x00, 0x00, 0x08, 0xF8, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00}, // l
-	{0xC0, 0xC0, 0xC0, 0x80, 0xC0, 0xC0, 0x80, 0x00, 0x1F, 0x1F, 0x00, 0x1F, 0x00, 0x1F, 0x1F}, // m
-	{0x40, 0xC0, 0x80, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00, 0x1F, 0x1F}, // n
-	{0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x10, 0x1F, 0x0F}, // o
-	{0x40, 0xC0, 0x80, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x80, 0xFF, 0xFF, 0x90, 0x10, 0x1F, 0x0F}, // p
-	{0x80, 0xC0, 0x40, 0x40, 0x80, 0xC0, 0x40, 0x00, 0x0F, 0x1F, 0x10, 0x90, 0xFF, 0xFF, 0x80}, // q
-	{0x40, 0xC0, 0x80, 0xC0, 0x40, 0xC0, 0x80, 0x00, 0x10, 0x1F, 0x1F, 0x10, 0x00, 0x00, 0x01}, // r
-	{0x80, 0xC0, 0x40, 0x40, 0x40, 0xC0, 0x80, 0x00, 0x08, 0x19, 0x13, 0x12, 0x16, 0x1C, 0x08}, // s
-	{0x40, 0x40, 0xF0, 0xF8, 0x40, 0x40, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x18, 0x08}, // t
-	{0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10, 0x0F, 0x1F, 0x10}, // u
-	{0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0x07, 0x0F, 0x18, 0x18, 0x0F, 0x07}, // v
-	{0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x0F, 0x1F, 0x18, 0x0E, 0x18, 0x1F, 0x0F}, // w
-	{0x40, 0xC0, 0x80, 0x00, 0x80, 0xC0, 0x40, 0x00, 0x10, 0x18, 0x0F, 0x07, 0x0F, 0x18, 0x10}, // x
-	{0xC0, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x8F, 0x9F, 0x90, 0x90, 0xD0, 0x7F, 0x3F}, // y
-	{0xC0, 0xC0, 0x40, 0x40, 0xC0, 0xC0, 0x40, 0x00, 0x18, 0x1C, 0x16, 0x13, 0x11, 0x18, 0x18}, // z
-	{0x00, 0x80, 0x80, 0xF0, 0x78, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x1F, 0x10, 0x10}, // {
-	{0x00, 0x00, 0x00, 0x78, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x1F, 0x00, 0x00}, // |
-	{0x00, 0x08, 0x08, 0x78, 0xF0, 0x80, 0x80, 0x00, 0x00, 0x10, 0x10, 0x1F, 0x0F, 0x00, 0x00}, // }
-	{0x80, 0xC0, 0x40, 0xC0, 0x80, 0xC0, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}  // ~
+// The big fonts are two pages tall. Every column of a glyph is an index into
+// gFontColumns, which holds the top and bottom page byte of each distinct
+// column. The last column of a gFontBig glyph is always blank and not stored.
+
+const uint8_t gFontColumns[215][2] = {
+	{0x00, 0x00}, {0xF8, 0x1F}, {0x08, 0x10}, {0x88, 0x10}, {0xC0, 0x1F}, {0x00, 0x10}, {0x00, 0x01}, {0x40, 0x10}, // 0x00
+	{0x80, 0x03}, {0x80, 0x1F}, {0xF0, 0x0F}, {0x18, 0x18}, {0x8C, 0x61}, {0xF0, 0x1F}, {0x00, 0x18}, {0x40, 0x00}, // 0x08
+	{0x80, 0x00}, {0xE0, 0x07}, {0x70, 0x00}, {0x80, 0x0F}, {0xC0, 0x0F}, {0x00, 0x40}, {0x80, 0x04}, {0xC0, 0x00}, // 0x10
+	{0xC0, 0x07}, {0xF8, 0x3F}, {0x00, 0x1C}, {0x18, 0x00}, {0x60, 0x0C}, {0x80, 0x01}, {0xC0, 0x18}, {0xF8, 0x0F}, // 0x18
+	{0xFC, 0x7F}, {0x0C, 0x60}, {0x30, 0x00}, {0x40, 0x11}, {0x88, 0x11}, {0x00, 0x0E}, {0x00, 0x0F}, {0x00, 0x1E}, // 0x20
+	{0x0C, 0x66}, {0x38, 0x00}, {0x40, 0x90}, {0x70, 0x0F}, {0x78, 0x00}, {0x78, 0x1F}, {0xCC, 0x60}, {0xF8, 0x07}, // 0x28
+	{0xF8, 0x10}, {0x00, 0x03}, {0x00, 0x07}, {0x00, 0x0C}, {0x08, 0x00}, {0x10, 0x10}, {0x1E, 0x00}, {0x30, 0x18}, // 0x30
+	{0x38, 0x1C}, {0x3E, 0x00}, {0x40, 0x04}, {0x40, 0x18}, {0x40, 0x80}, {0x78, 0x1E}, {0x80, 0x08}, {0x80, 0xFF}, // 0x38
+	{0xC0, 0x01}, {0xC0, 0x10}, {0xC0, 0x19}, {0xC0, 0x1C}, {0xC8, 0x10}, {0xE0, 0x00}, {0xE0, 0x0F}, {0x00, 0x06}, // 0x40
+	{0x00, 0x90}, {0x07, 0x00}, {0x08, 0x11}, {0x08, 0x13}, {0x0C, 0x00}, {0x0C, 0x1F}, {0x0C, 0x67}, {0x0E, 0x00}, // 0x48
+	{0x10, 0x00}, {0x18, 0x10}, {0x18, 0x1E}, {0x18, 0x30}, {0x30, 0x01}, {0x30, 0x0C}, {0x40, 0x05}, {0x40, 0x13}, // 0x50
+	{0x40, 0x16}, {0x48, 0x10}, {0x60, 0x18}, {0x70, 0x1E}, {0x78, 0x18}, {0x78, 0x3F}, {0x80, 0x10}, {0x88, 0x00}, // 0x58
+	{0x88, 0x01}, {0x8F, 0x38}, {0x90, 0x17}, {0xB0, 0x1F}, {0xC0, 0x06}, {0xC0, 0x7F}, {0xC0, 0xFF}, {0xC8, 0x11}, // 0x60
+	{0xCC, 0x71}, {0xD8, 0x1F}, {0xDC, 0x73}, {0xE0, 0x03}, {0xE0, 0x1F}, {0xF8, 0x00}, {0xF8, 0x03}, {0xF8, 0x1B}, // 0x68
+	{0x00, 0x08}, {0x00, 0x11}, {0x00, 0x1F}, {0x00, 0x20}, {0x00, 0x3C}, {0x00, 0x60}, {0x00, 0x80}, {0x00, 0xD0}, // 0x70
+	{0x00, 0xE0}, {0x08, 0x0F}, {0x08, 0x12}, {0x08, 0x1C}, {0x08, 0x1E}, {0x08, 0x1F}, {0x08, 0x78}, {0x0C, 0x40}, // 0x78
+	{0x0C, 0x6E}, {0x0C, 0x76}, {0x0C, 0x78}, {0x0C, 0x7C}, {0x0F, 0x00}, {0x10, 0x08}, {0x10, 0x1C}, {0x10, 0x30}, // 0x80
+	{0x10, 0x70}, {0x18, 0x01}, {0x18, 0x0F}, {0x18, 0x1C}, {0x1C, 0x00}, {0x1C, 0x33}, {0x1C, 0x67}, {0x1C, 0x70}, // 0x88
+	{0x1C, 0x7C}, {0x20, 0x00}, {0x20, 0x10}, {0x30, 0x07}, {0x30, 0x0E}, {0x30, 0x10}, {0x30, 0x11}, {0x30, 0x1E}, // 0x90
+	{0x30, 0x1F}, {0x38, 0x18}, {0x38, 0x1F}, {0x38, 0x3F}, {0x38, 0x73}, {0x38, 0x78}, {0x38, 0x7C}, {0x3C, 0x00}, // 0x98
+	{0x3C, 0x78}, {0x40, 0x12}, {0x40, 0x1F}, {0x60, 0x00}, {0x60, 0x01}, {0x60, 0x1C}, {0x70, 0x06}, {0x70, 0x18}, // 0xA0
+	{0x78, 0x0F}, {0x78, 0x1C}, {0x80, 0x07}, {0x80, 0x09}, {0x80, 0x4F}, {0x88, 0x08}, {0x88, 0x18}, {0x88, 0x1B}, // 0xA8
+	{0x88, 0x1F}, {0x8C, 0x07}, {0x8C, 0x3F}, {0x8C, 0x73}, {0x98, 0x0F}, {0x98, 0x10}, {0x9C, 0x33}, {0x9C, 0x61}, // 0xB0
+	{0x9C, 0x71}, {0xB8, 0x3F}, {0xB8, 0x77}, {0xC0, 0x11}, {0xC0, 0x3F}, {0xC0, 0x8F}, {0xC0, 0x9F}, {0xC0, 0xDF}, // 0xB8
+	{0xC8, 0x01}, {0xC8, 0x1B}, {0xCC, 0x70}, {0xCC, 0x7B}, {0xD8, 0x7F}, {0xD8, 0xFF}, {0xE0, 0x18}, {0xEC, 0x03}, // 0xC0
+	{0xF0, 0x07}, {0xF0, 0x11}, {0xF0, 0x17}, {0xF0, 0x4F}, {0xF0, 0x60}, {0xF8, 0x08}, {0xF8, 0x0C}, {0xF8, 0x18}, // 0xC8
+	{0xF8, 0x33}, {0xF8, 0x61}, {0xF8, 0x7F}, {0xFC, 0x00}, {0xFC, 0x18}, {0xFC, 0x30}, {0xFC, 0x63}                // 0xD0
+};
+
+const uint8_t gFontBig[95][7] = {
+	{0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}, // ' '
+	{0x00, 0x00, 0x12, 0x6F, 0x6F, 0x12, 0x00}, // !
+	{0x00, 0x36, 0x39, 0x00, 0x00, 0x39, 0x36}, // "
+	{0x3A, 0x0D, 0x0D, 0x3A, 0x0D, 0x0D, 0x3A}, // #
+	{0xA6, 0xCE, 0xAD, 0x61, 0x61, 0xB4, 0x93}, // $
+	{0x5A, 0x1C, 0x47, 0x31, 0x1D, 0x1E, 0x5A}, // %
+	{0x26, 0x63, 0x30, 0x67, 0xA8, 0x63, 0x5E}, // &
+	{0x00, 0x91, 0x39, 0x36, 0x00, 0x00, 0x00}, // '
+	{0x00, 0x00, 0x11, 0x0A, 0x0B, 0x02, 0x00}, // (
+	{0x00, 0x00, 0x02, 0x0B, 0x0A, 0x11, 0x00}, // )
+	{0x06, 0x56, 0x18, 0x08, 0x08, 0x18, 0x56}, // *
+	{0x00, 0x06, 0x06, 0x18, 0x18, 0x06, 0x06}, // +
+	{0x00, 0x00, 0x73, 0x74, 0x1A, 0x00, 0x00}, // ,
+	{0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06}, // -
+	{0x00, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0x00}, // .
+	{0x0E, 0x33, 0x47, 0x31, 0x1D, 0x17, 0xA3}, // /
+	{0x0A, 0x01, 0x7A, 0x24, 0x59, 0x01, 0x0A}, // 0
+	{0x00, 0x92, 0x95, 0x01, 0x01, 0x05, 0x05}, // 1
+	{0x86, 0x52, 0x4B, 0x24, 0x44, 0x5C, 0x37}, // 2
+	{0x85, 0x0B, 0x03, 0x03, 0x03, 0x01, 0x2B}, // 3
+	{0x1D, 0x40, 0xA4, 0x96, 0x01, 0x01, 0x71}, // 4
+	{0xCD, 0xCF, 0x03, 0x03, 0x24, 0xB0, 0x79}, // 5
+	{0x46, 0x0D, 0xB5, 0x03, 0x03, 0x09, 0x26}, // 6
+	{0x1B, 0x1B, 0x7C, 0x7D, 0x60, 0x6D, 0x2C}, // 7
+	{0x2B, 0x01, 0x03, 0x03, 0x03, 0x01, 0x2B}, // 8
+	{0x12, 0x30, 0x03, 0x03, 0xAE, 0x1F, 0xC8}, // 9
+	{0x00, 0x00, 0x00, 0x1C, 0x1C, 0x00, 0x00}, // :
+	{0x00, 0x00, 0x05, 0xA5, 0x1C, 0x00, 0x00}, // ;
+	{0x00, 0x06, 0x08, 0x64, 0x1C, 0x37, 0x35}, // <
+	{0x16, 0x16, 0x16, 0x16, 0x16, 0x16, 0x16}, // =
+	{0x00, 0x35, 0x37, 0x1C, 0x64, 0x08, 0x06}, // >
+	{0x22, 0x29, 0x34, 0xAF, 0xC1, 0x2C, 0x22}, // ?
+	{0x46, 0x0D, 0x35, 0x62, 0x62, 0xCA, 0x6B}, // @
+	{0x04, 0x6C, 0x54, 0x89, 0x54, 0x6C, 0x04}, // A
+	{0x02, 0x01, 0x01, 0x03, 0x03, 0x01, 0x2B}, // B
+	{0x11, 0x0A, 0x0B, 0x02, 0x02, 0x0B, 0x55}, // C
+	{0x02, 0x01, 0x01, 0x02, 0x0B, 0x0A, 0x11}, // D
+	{0x02, 0x01, 0x01, 0x03, 0x67, 0x0B, 0x38}, // E
+	{0x02, 0x01, 0x01, 0x03, 0xC0, 0x1B, 0x29}, // F
+	{0x11, 0x0A, 0x0B, 0x4A, 0x4A, 0x8A, 0x98}, // G
+	{0x01, 0x01, 0x10, 0x10, 0x10, 0x01, 0x01}, // H
+	{0x00, 0x00, 0x02, 0x01, 0x01, 0x02, 0x00}, // I
+	{0x25, 0x27, 0x05, 0x02, 0x01, 0x1F, 0x34}, // J
+	{0x02, 0x01, 0x01, 0x1D, 0x6B, 0x3D, 0x8B}, // K
+	{0x02, 0x01, 0x01, 0x02, 0x05, 0x0E, 0x1A}, // L
+	{0x01, 0x01, 0x12, 0x45, 0x12, 0x01, 0x01}, // M
+	{0x01, 0x01, 0x12, 0x45, 0x40, 0x01, 0x01}, // N
+	{0x11, 0x0A, 0x0B, 0x02, 0x0B, 0x0A, 0x11}, // O
+	{0x02, 0x01, 0x01, 0x03, 0x5F, 0x6D, 0x12}, // P
+	{0x0A, 0x01, 0x02, 0x7B, 0x7E, 0xD2, 0xCB}, // Q
+	{0x02, 0x01, 0x01, 0x5F, 0x60, 0x01, 0x5B}, // R
+	{0x55, 0xA9, 0x44, 0x03, 0x24, 0x9A, 0x94}, // S
+	{0x00, 0x29, 0x51, 0x01, 0x01, 0x51, 0x29}, // T
+	{0x1F, 0x01, 0x05, 0x05, 0x05, 0x01, 0x1F}, // U
+	{0x6E, 0x2F, 0x33, 0x0E, 0x33, 0x2F, 0x6E}, // V
+	{0x2F, 0x01, 0x1A, 0x32, 0x1A, 0x01, 0x2F}, // W
+	{0x0B, 0x3D, 0x11, 0x1D, 0x11, 0x3D, 0x0B}, // X
+	{0x00, 0x2C, 0x30, 0x09, 0x09, 0x30, 0x2C}, // Y
+	{0x38, 0x52, 0x4B, 0x24, 0x44, 0x5C, 0x38}, // Z
+	{0x00, 0x00, 0x01, 0x01, 0x02, 0x02, 0x00}, // [
+	{0x12, 0x45, 0x40, 0x08, 0x32, 0x25, 0x1A}, // "\"
+	{0x00, 0x00, 0x02, 0x02, 0x01, 0x01, 0x00}, // ]
+	{0x50, 0x1B, 0x4F, 0x49, 0x4F, 0x1B, 0x50}, // ^
+	{0x15, 0x15, 0x15, 0x15, 0x15, 0x15, 0x15}, // _
+	{0x00, 0x00, 0x49, 0x84, 0x34, 0x00, 0x00}, // `
+	{0x25, 0xA2, 0x23, 0x23, 0x14, 0x09, 0x05}, // a
+	{0x02, 0x01, 0x1F, 0x07, 0x41, 0x09, 0x26}, // b
+	{0x13, 0x04, 0x07, 0x07, 0x07, 0x1E, 0x3E}, // c
+	{0x26, 0x09, 0x41, 0x59, 0x1F, 0x01, 0x05}, // d
+	{0x13, 0x04, 0x23, 0x23, 0x23, 0x42, 0xAB}, // e
+	{0x5E, 0x0D, 0x01, 0x03, 0x1B, 0x22, 0x00}, // f
+	{0xAC, 0xBF, 0x2A, 0x2A, 0x3F, 0x65, 0x0F}, // g
+	{0x02, 0x01, 0x01, 0x10, 0x0F, 0x04, 0x09}, // h
+	{0x00, 0x00, 0x07, 0x69, 0x69, 0x05, 0x00}, // i
+	{0x00, 0x75, 0x78, 0x76, 0x3C, 0xC5, 0xC4}, // j
+	{0x02, 0x01, 0x01, 0x31, 0xAA, 0x43, 0x3B}, // k
+	{0x00, 0x00, 0x02, 0x01, 0x01, 0x05, 0x00}, // l
+	{0x04, 0x04, 0x17, 0x09, 0x17, 0x04, 0x09}, // m
+	{0x0F, 0x04, 0x09, 0x0F, 0x0F, 0x04, 0x09}, // n
+	{0x13, 0x04, 0x07, 0x07, 0x07, 0x04, 0x13}, // o
+	{0x3C, 0x66, 0x3F, 0x2A, 0x07, 0x04, 0x13}, // p
+	{0x13, 0x04, 0x07, 0x2A, 0x3F, 0x66, 0x3C}, // q
+	{0x07, 0x04, 0x09, 0x41, 0x0F, 0x17, 0x1D}, // r
+	{0x3E, 0x42, 0x57, 0xA1, 0x58, 0x43, 0x3E}, // s
+	{0x0F, 0x0F, 0x0A, 0x01, 0x07, 0x3B, 0x70}, // t
+	{0x14, 0x04, 0x05, 0x05, 0x14, 0x04, 0x05}, // u
+	{0x00, 0x18, 0x14, 0x0E, 0x0E, 0x14, 0x18}, // v
+	{0x14, 0x04, 0x0E, 0x25, 0x0E, 0x04, 0x14}, // w
+	{0x07, 0x1E, 0x13, 0x32, 0x13, 0x1E, 0x07}, // x
+	{0xBD, 0xBE, 0x48, 0x48, 0x77, 0x65, 0xBC}, // y
+	{0x1E, 0x43, 0x58, 0x57, 0xBB, 0x1E, 0x3B}, // z
+	{0x00, 0x10, 0x10, 0x0A, 0x2D, 0x02, 0x02}, // {
+	{0x00, 0x00, 0x00, 0x2D, 0x2D, 0x00, 0x00}, // |
+	{0x00, 0x02, 0x02, 0x2D, 0x0A, 0x10, 0x10}, // }
+	{0x10, 0x17, 0x0F, 0x17, 0x10, 0x17, 0x0F}  // ~
 };
 
-const uint8_t gFontBigDigits[11][26] = {
-	{ 0x00, 0xC0, 0xF0, 0xF8, 0x3C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1C, 0xF8, 0xF0, 0xE0, 0x00, 0x07, 0x1F, 0x3F, 0x78, 0x60, 0x60, 0x60, 0x60, 0x70, 0x3F, 0x1F, 0x0F },
-	{ 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x7F, 0x7F, 0x00, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x10, 0x38, 0x38, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0xFC, 0xF8, 0xF0, 0x00, 0x00, 0x70, 0x78, 0x7C, 0x7C, 0x6E, 0x66, 0x67, 0x67, 0x63, 0x61, 0x60, 0x00 },
-	{ 0x00, 0x10, 0x18, 0x18, 0x9C, 0x8C, 0x8C, 0x8C, 0x8C, 0xCC, 0xF8, 0xF8, 0x70, 0x00, 0x30, 0x30, 0x30, 0x71, 0x61, 0x61, 0x61, 0x61, 0x71, 0x3F, 0x3F, 0x1E },
-	{ 0x00, 0x00, 0x00, 0x00, 0x80, 0xC0, 0xE0, 0x70, 0x38, 0xFC, 0xFC, 0xFC, 0x00, 0x00, 0x1C, 0x1E, 0x1F, 0x1F, 0x19, 0x18, 0x18, 0x18, 0x7F, 0x7F, 0x7F, 0x18 },
-	{ 0x00, 0x00, 0xFC, 0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x8C, 0x0C, 0x00, 0x00, 0x18, 0x30, 0x70, 0x60, 0x60, 0x60, 0x60, 0x71, 0x7B, 0x3F, 0x1F },
-	{ 0x00, 0xC0, 0xF0, 0xF8, 0x38, 0x9C, 0x8C, 0x8C, 0x8C, 0x8C, 0x9C, 0x38, 0x30, 0x00, 0x0F, 0x1F, 0x3F, 0x73, 0x61, 0x61, 0x61, 0x61, 0x73, 0x33, 0x3F, 0x1E },
-	{ 0x00, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x8C, 0xEC, 0xFC, 0x3C, 0x1C, 0x00, 0x00, 0x00, 0x40, 0x60, 0x78, 0x7C, 0x1F, 0x07, 0x03, 0x00, 0x00, 0x00 },
-	{ 0x00, 0x00, 0x78, 0xF8, 0xDC, 0x8C, 0x8C, 0x8C, 0x8C, 0xDC, 0xF8, 0x78, 0x00, 0x00, 0x1E, 0x3F, 0x3F, 0x73, 0x61, 0x61, 0x61, 0x61, 0x73, 0x3F, 0x3F, 0x1E },
-	{ 0x00, 0xF0, 0xF8, 0xB8, 0x1C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1C, 0xB8, 0xF0, 0xE0, 0x00, 0x11, 0x33, 0x77, 0x67, 0x66, 0x66, 0x66, 0x76, 0x33, 0x3F, 0x1F, 0x07 },
-	{ 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x00, 0x00 },
+const uint8_t gFontBigDigits[11][13] = {
+	{ 0x00, 0x18, 0x0D, 0x19, 0xA0, 0x21, 0x21, 0x21, 0x21, 0x8F, 0x19, 0x0D, 0x46 },
+	{ 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x20, 0x20, 0x20, 0x00, 0x00, 0x00, 0x00 },
+	{ 0x00, 0x88, 0x9D, 0x9E, 0x90, 0x80, 0x28, 0x4E, 0x4E, 0xD6, 0xD1, 0xCC, 0x00 },
+	{ 0x00, 0x87, 0x53, 0x53, 0xB8, 0x0C, 0x0C, 0x0C, 0x0C, 0x68, 0x19, 0x19, 0x5B },
+	{ 0x00, 0x1A, 0x27, 0x72, 0x09, 0x42, 0xC6, 0xA7, 0x99, 0x20, 0x20, 0x20, 0x0E },
+	{ 0x00, 0x00, 0xD4, 0xD5, 0xC2, 0x2E, 0x2E, 0x2E, 0x2E, 0x68, 0xC3, 0xB2, 0x4D },
+	{ 0x00, 0x14, 0x0D, 0x19, 0x9C, 0xB7, 0x0C, 0x0C, 0x0C, 0xB3, 0xB6, 0x9B, 0x97 },
+	{ 0x00, 0x4C, 0x4C, 0x7F, 0x21, 0x82, 0x83, 0x4D, 0xB1, 0xC7, 0xD3, 0x9F, 0x8C },
+	{ 0x00, 0x27, 0x5D, 0x19, 0x6A, 0x0C, 0x0C, 0x0C, 0x0C, 0x6A, 0x19, 0x5D, 0x27 },
+	{ 0x00, 0xC9, 0xD0, 0xBA, 0x8E, 0x28, 0x28, 0x28, 0x81, 0x8D, 0xB9, 0x0D, 0x11 },
+	{ 0x00, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00 },
 };
 
 const uint8_t gFontSmallDigits[11][7] = {
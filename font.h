@@ -20,8 +20,9 @@
 
 #include <stdint.h>
 
-extern const uint8_t gFontBig[95][15]; // 1o11
-extern const uint8_t gFontBigDigits[11][26];
+extern const uint8_t gFontColumns[215][2];
+extern const uint8_t gFontBig[95][7]; // 1o11
+extern const uint8_t gFontBigDigits[11][13];
 extern const uint8_t gFontSmallDigits[11][7];
 
 #endif
@@ -33,6 +33,7 @@
 #include "misc.h"
 #include "radio.h"
 #include "settings.h"
+#include "timer.h"
 #include "ui/status.h"
 #include "ui/ui.h"
 
@@ -55,12 +56,12 @@ void FUNCTION_Init(void)
 	g_CDCSS_Lost = false;
 	g_CTCSS_Lost = false;
 	g_SquelchLost = false;
-	gTailNoteEliminationCountdown = 0;
+	TIMER_Stop(TIMER_TAIL_NOTE);
 	gFlagTteComplete = false;
 	gFoundCTCSS = false;
 	gFoundCDCSS = false;
-	gFoundCTCSSCountdown = 0;
-	gFoundCDCSSCountdown = 0;
+	TIMER_Stop(TIMER_FOUND_CTCSS);
+	TIMER_Stop(TIMER_FOUND_CDCSS);
 	gEndOfRxDetectedMaybe = false;
 }
 
@@ -72,6 +73,7 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
 	PreviousFunction = gCurrentFunction;
 	bWasPowerSave = (PreviousFunction == FUNCTION_POWER_SAVE);
 	gCurrentFunction = Function;
+	TIMER_SetMode(Function);
 
 	if (bWasPowerSave) {
 		if (Function != FUNCTION_POWER_SAVE) {
@@ -108,7 +110,7 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
 		break;
 
 	case FUNCTION_POWER_SAVE:
-		gBatterySave = 40;
+		TIMER_Start(TIMER_BATTERY_SAVE, 40);
 		gRxIdleMode = true;
 
 		BK4819_Sleep();
@@ -141,7 +143,7 @@ void FUNCTION_Select(FUNCTION_Type_t Function)
 		break;
 	}
 
-	gBatterySaveCountdown = 1000;
+	TIMER_Start(TIMER_POWER_SAVE, 1000);
 	gSchedulePowerSave = false;
 #if defined(ENABLE_FMRADIO)
 	gFM_RestoreCountdown = 0;
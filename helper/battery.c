@@ -33,7 +33,6 @@ bool gChargingWithTypeC;
 bool gLowBattery;
 bool gLowBatteryBlink;
 
-volatile uint16_t gBatterySave;
 
 uint16_t gBatteryCheckCounter;
 
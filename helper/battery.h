@@ -32,7 +32,6 @@ extern bool gChargingWithTypeC;
 extern bool gLowBattery;
 extern bool gLowBatteryBlink;
 
-extern volatile uint16_t gBatterySave;
 
 extern uint16_t gBatteryCheckCounter;
 
@@ -55,7 +55,7 @@ void BOOT_ProcessMode(BOOT_Mode_t Mode)
 		gMenuCursor = MENU_F_LOCK;
 		gSubMenuSelection = gSetting_F_LOCK;
 		GUI_SelectNextDisplay(DISPLAY_MENU); // Can't schedule due to button presses
-		gMenuListCount = 47; // Does include hidden items
+		gMenuListCount = 48; // Does include hidden items
 		gF_LOCK = true;
 	} else {
 		GUI_SelectNextDisplay(DISPLAY_MAIN); // Can't schedule as it's the first screen
@@ -0,0 +1,121 @@
+#include <stdbool.h>
+#include "helper/format.h"
+
+// Digits are peeled off by repeated subtraction, the M0 has no divider
+static const uint32_t gPowersOfTen[10] = {
+	1000000000U,
+	100000000U,
+	10000000U,
+	1000000U,
+	100000U,
+	10000U,
+	1000U,
+	100U,
+	10U,
+	1U,
+};
+
+static char *Decimal(char *pOut, uint32_t Value, uint8_t Width, char Pad)
+{
+	bool bStarted = false;
+	uint8_t i;
+
+	for (i = 0; i < 9; i++) {
+		const uint32_t Power = gPowersOfTen[i];
+		char Digit = '0';
+
+		while (Value >= Power) {
+			Value -= Power;
+			Digit++;
+		}
+		if (Digit != '0') {
+			bStarted = true;
+		}
+		if (bStarted) {
+			*pOut++ = Digit;
+		} else if (Width >= 10U - i) {
+			*pOut++ = Pad;
+		}
+	}
+	*pOut++ = '0' + Value;
+	*pOut = 0;
+
+	return pOut;
+}
+
+static char *Radix(char *pOut, uint32_t Value, uint8_t Width, uint8_t Shift)
+{
+	const uint32_t Mask = (1U << Shift) - 1U;
+	uint8_t Digits = 1;
+	uint8_t i;
+
+	while (Digits * Shift < 32U && (Value >> (Digits * Shift)) != 0) {
+		Digits++;
+	}
+	if (Digits < Width) {
+		Digits = Width;
+	}
+
+	for (i = Digits; i > 0; i--) {
+		const uint8_t Bit = (i - 1U) * Shift;
+		const uint8_t Digit = (Bit < 32U) ? (Value >> Bit) & Mask : 0;
+
+		*pOut++ = (Digit < 10) ? '0' + Digit : 'a' + Digit - 10;
+	}
+	*pOut = 0;
+
+	return pOut;
+}
+
+char *FORMAT_String(char *pOut, const char *pString)
+{
+	while (*pString) {
+		*pOut++ = *pString++;
+	}
+	*pOut = 0;
+
+	return pOut;
+}
+
+char *FORMAT_Char(char *pOut, char Char)
+{
+	*pOut++ = Char;
+	*pOut = 0;
+
+	return pOut;
+}
+
+char *FORMAT_Unsigned(char *pOut, uint32_t Value, uint8_t Width)
+{
+	return Decimal(pOut, Value, Width, '0');
+}
+
+char *FORMAT_Aligned(char *pOut, uint32_t Value, uint8_t Width)
+{
+	return Decimal(pOut, Value, Width, ' ');
+}
+
+char *FORMAT_Fixed(char *pOut, uint32_t Value, uint8_t Decimals)
+{
+	char *pEnd = Decimal(pOut, Value, Decimals + 1U, '0');
+	uint8_t i;
+
+	// Move the decimals up by one to make room for the point
+	for (i = 0; i <= Decimals; i++) {
+		pEnd[1 - i] = pEnd[-i];
+	}
+	pEnd[-Decimals] = '.';
+
+	return pEnd + 1;
+}
+
+char *FORMAT_Hex(char *pOut, uint32_t Value, uint8_t Width)
+{
+	return Radix(pOut, Value, Width, 4);
+}
+
+char *FORMAT_Octal(char *pOut, uint32_t Value, uint8_t Width)
+{
+	return Radix(pOut, Value, Width, 3);
+}
+
@@ -0,0 +1,25 @@
+#ifndef FORMAT_H
+#define FORMAT_H
+
+#include <stdint.h>
+
+// Fixed format replacements for sprintf. Each call writes its field and
+// a terminating NUL at pOut and returns a pointer to that NUL, so fields
+// are concatenated by chaining the calls.
+
+char *FORMAT_String(char *pOut, const char *pString);
+char *FORMAT_Char(char *pOut, char Char);
+// Decimal, zero padded to at least Width digits ("%0*u"), Width <= 10
+char *FORMAT_Unsigned(char *pOut, uint32_t Value, uint8_t Width);
+// Decimal, space padded to at least Width characters ("%*u"), Width <= 10
+char *FORMAT_Aligned(char *pOut, uint32_t Value, uint8_t Width);
+// Value / 10^Decimals with that many zero padded decimals, e.g. a
+// frequency in 10 Hz units with 5 decimals gives MHz ("%u.%05u")
+char *FORMAT_Fixed(char *pOut, uint32_t Value, uint8_t Decimals);
+// Lower case hex, zero padded ("%0*x")
+char *FORMAT_Hex(char *pOut, uint32_t Value, uint8_t Width);
+// Octal, zero padded, as used for DCS codes ("%0*o")
+char *FORMAT_Octal(char *pOut, uint32_t Value, uint8_t Width);
+
+#endif
+
@@ -17,15 +17,18 @@
  */
 
 #include <stdint.h>
+#include "ARMCM0.h"
+#include "init.h"
 
 extern uint32_t __bss_start__[];
 extern uint32_t __bss_end__[];
 extern uint8_t flash_data_start[];
 extern uint8_t sram_data_start[];
 extern uint8_t sram_data_end[];
+extern uint32_t Stack[];
 
-void BSS_Init(void);
-void DATA_Init(void);
+// Initial SP from the vector table
+#define STACK_TOP ((uint32_t *)(uintptr_t)Stack[0])
 
 void BSS_Init(void)
 {
@@ -48,3 +51,28 @@ void DATA_Init(void)
 	}
 }
 
+void STACK_Init(void)
+{
+	uint32_t *pStack;
+	uint32_t *pEnd = (uint32_t *)(uintptr_t)__get_MSP();
+
+	// Everything below the live stack pointer is free at this point
+	for (pStack = __bss_end__; pStack < pEnd; pStack++) {
+		*pStack = STACK_PAINT;
+	}
+}
+
+void RAM_GetUsage(RAM_Usage_t *pUsage)
+{
+	uint32_t *pStack = __bss_end__;
+
+	while (pStack < STACK_TOP && *pStack == STACK_PAINT) {
+		pStack++;
+	}
+
+	pUsage->DataSize = sram_data_end - sram_data_start;
+	pUsage->BssSize = (uint8_t *)__bss_end__ - (uint8_t *)__bss_start__;
+	pUsage->StackSize = (uint8_t *)STACK_TOP - (uint8_t *)__bss_end__;
+	pUsage->StackMaxUsed = (uint8_t *)STACK_TOP - (uint8_t *)pStack;
+}
+
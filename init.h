@@ -0,0 +1,23 @@
+#ifndef INIT_H
+#define INIT_H
+
+#include <stdint.h>
+
+// Written over the RAM between .bss and the stack at boot. Words that
+// still hold it have never been reached by the stack.
+#define STACK_PAINT 0xA5A5A5A5U
+
+typedef struct {
+	uint16_t DataSize;
+	uint16_t BssSize;
+	uint16_t StackSize;
+	uint16_t StackMaxUsed;
+} RAM_Usage_t;
+
+void BSS_Init(void);
+void DATA_Init(void);
+void STACK_Init(void);
+void RAM_GetUsage(RAM_Usage_t *pUsage);
+
+#endif
+
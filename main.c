@@ -17,6 +17,9 @@
 #include <string.h>
 #include "app/app.h"
 #include "app/dtmf.h"
+#if defined(ENABLE_UART)
+#include "app/uart.h"
+#endif
 #include "bsp/dp32g030/gpio.h"
 #include "bsp/dp32g030/syscon.h"
 #include "board.h"
@@ -34,6 +37,7 @@
 #include "mdc1200.h"
 #endif
 #include "misc.h"
+#include "profiler.h"
 #include "radio.h"
 #include "settings.h"
 //#include "task/battery.h"
@@ -44,9 +48,15 @@
 #include "task/radio.h"
 #include "task/scanner.h"
 #include "task/screen.h"
+#if defined(ENABLE_SPECTRUM)
+#include "task/spectrum.h"
+#endif
 #include "ui/lock.h"
+#if defined(ENABLE_SPECTRUM)
+#include "ui/ui.h"
+#endif
 
-#if defined(ENABLE_UART)
+#if defined(ENABLE_PRINTF) && defined(ENABLE_UART)
 void _putchar(char c)
 {
 	UART_Send((uint8_t *)&c, 1);
@@ -68,6 +78,7 @@ void Main(void)
 		;
 
 	SYSTICK_Init();
+	SCHEDULER_Init();
 	BOARD_Init();
 	BK4819_Init();
 
@@ -87,8 +98,14 @@ void Main(void)
 	gDTMF_String[14] = 0;
 
 	memset(&gEeprom, 0, sizeof(gEeprom));
+#if defined(ENABLE_PERF_STATS)
+	gBootStats.EepromUs = SCHEDULER_GetTimeUs();
+#endif
 	BOARD_EEPROM_Init();
 	BOARD_EEPROM_LoadCalibration();
+#if defined(ENABLE_PERF_STATS)
+	gBootStats.EepromUs = SCHEDULER_GetTimeUs() - gBootStats.EepromUs;
+#endif
 
 	RADIO_ConfigureChannel(0, 2);
 	RADIO_ConfigureChannel(1, 2);
@@ -111,38 +128,52 @@ void Main(void)
 			UI_DisplayLock();
 			bIsInLockScreen = false;
 		}
-		gMenuListCount = 45; // Does not include hidden items
+		gMenuListCount = 46; // Does not include hidden items
 		BOOT_Mode_t BootMode = BOOT_GetMode();
 		BOOT_ProcessMode(BootMode);
 		gUpdateStatus = true;
 	}
 
-	// Everything is initialised, set SLEEP* bits to save power
-	SYSCON_REGISTER |= SYSCON_REGISTER_SLEEPONEXIT_BITS_ENABLE;
-	SYSCON_REGISTER |= SYSCON_REGISTER_SLEEPDEEP_BITS_ENABLE;
+	// The loop below sleeps with WFI until the next task is posted. Deep
+	// sleep would stop SysTick and sleep-on-exit would never return to the
+	// loop, so only plain sleep is used.
 
 	while (1) {
-		if (SCHEDULER_CheckTask(TASK_SLEEP)) {
-			continue;
-		}
-
-		APP_Update(); // Does not rely on sub-10ms timings
+		PROFILE(PROFILER_APP_UPDATE, true, APP_Update()); // Does not rely on sub-10ms timings
+#if defined(ENABLE_SPECTRUM)
+		TASK_Spectrum(); // Paced by its own RSSI dwell
+#endif
 
 		// 10ms
-		TASK_CheckKeys();
-		TASK_CheckRadioInterrupts();
-		TASK_UpdateScreen();
+		PROFILE(PROFILER_CHECK_KEYS, SCHEDULER_CheckTask(TASK_CHECK_KEYS), TASK_CheckKeys());
+		PROFILE(PROFILER_RADIO_INTERRUPTS, SCHEDULER_CheckTask(TASK_CHECK_RADIO_INTERRUPTS), TASK_CheckRadioInterrupts());
+		PROFILE(PROFILER_UPDATE_SCREEN, SCHEDULER_CheckTask(TASK_UPDATE_SCREEN), TASK_UpdateScreen());
 
 		// 500ms
 #if defined(ENABLE_FMRADIO)
 		TASK_FM_Radio();
 #endif
-		TASK_Scanner();
+		PROFILE(PROFILER_SCANNER, SCHEDULER_CheckTask(TASK_SCANNER), TASK_Scanner());
 
 		if (gNextTimeslice500ms) {
-			APP_TimeSlice500ms();
+			PROFILE(PROFILER_SLICE_500MS, true, APP_TimeSlice500ms());
 			gNextTimeslice500ms = false;
 		}
+
+#if defined(ENABLE_SPECTRUM)
+		// The sweep is paced by its RSSI dwell, not by the tick
+		if (gScreenToDisplay == DISPLAY_SPECTRUM) {
+			continue;
+		}
+#endif
+#if defined(ENABLE_UART)
+		// A read stream goes out a chunk per pass, sleeping would cut it
+		// down to a chunk per tick
+		if (UART_IsStreaming()) {
+			continue;
+		}
+#endif
+		SCHEDULER_Sleep();
 	}
 }
 
@@ -36,12 +36,9 @@ uint8_t gTryCount;
 uint16_t gEEPROM_RSSI_CALIB[7][4];
 
 uint8_t gMR_ChannelAttributes[FREQ_CHANNEL_LAST + 1];
+MR_Channel_t gMR_Channels[MR_CHANNEL_LAST + 1];
 
 volatile bool gNextTimeslice500ms;
-volatile uint16_t gBatterySaveCountdown = 1000;
-volatile uint16_t gDualWatchCountdown;
-volatile uint16_t gTxTimerCountdown;
-volatile uint16_t gTailNoteEliminationCountdown;
 bool gEnableSpeaker;
 uint8_t gKeyLockCountdown;
 uint8_t gRTTECountdown;
@@ -99,8 +96,6 @@ uint8_t gFSKWriteIndex;
 bool gUpdateDisplay;
 bool gF_LOCK;
 uint8_t gShowChPrefix;
-volatile uint8_t gFoundCDCSSCountdown;
-volatile uint8_t gFoundCTCSSCountdown;
 volatile bool gTxTimeoutReached;
 volatile bool gNextTimeslice40ms;
 volatile bool gSchedulePowerSave;
@@ -60,6 +60,23 @@ enum CssScanMode_t {
 
 typedef enum CssScanMode_t CssScanMode_t;
 
+// RAM index of an MR channel record at 0000..0C7F, packed by
+// RADIO_PackChannel() to the fields RADIO_ConfigureChannel() uses.
+// Frequency and Offset keep 27 bits, enough for 1342 MHz, and the top
+// bits carry flags:
+//   Frequency 27-28 RX code type, 29-30 TX code type, 31 reverse
+//   Offset    27-28 bandwidth, 29-30 output power, 31 busy channel lock
+//   Flags     0-1 deviation, 2 DTMF decoding, 3-4 PTT ID, 5-7 step,
+//             8-9 compander, 10-11 modulation, 12-13 MDC1200
+#define MR_CHANNEL_FREQUENCY_MASK 0x07FFFFFFU
+
+typedef struct {
+	uint32_t Frequency;
+	uint32_t Offset;
+	uint8_t Code[2];
+	uint16_t Flags;
+} MR_Channel_t;
+
 extern bool gSetting_350TX;
 extern bool gSetting_200TX;
 extern bool gSetting_500TX;
@@ -74,12 +91,9 @@ extern uint8_t gTryCount;
 extern uint16_t gEEPROM_RSSI_CALIB[7][4];
 
 extern uint8_t gMR_ChannelAttributes[207];
+extern MR_Channel_t gMR_Channels[200];
 
 extern volatile bool gNextTimeslice500ms;
-extern volatile uint16_t gBatterySaveCountdown;
-extern volatile uint16_t gDualWatchCountdown;
-extern volatile uint16_t gTxTimerCountdown;
-extern volatile uint16_t gTailNoteEliminationCountdown;
 extern volatile uint16_t gFmPlayCountdown;
 extern bool gEnableSpeaker;
 extern uint8_t gKeyLockCountdown;
@@ -138,8 +152,6 @@ extern uint8_t gFSKWriteIndex;
 extern bool gUpdateDisplay;
 extern bool gF_LOCK;
 extern uint8_t gShowChPrefix;
-extern volatile uint8_t gFoundCDCSSCountdown;
-extern volatile uint8_t gFoundCTCSSCountdown;
 extern volatile bool gTxTimeoutReached;
 extern volatile bool gNextTimeslice40ms;
 extern volatile bool gSchedulePowerSave;
@@ -0,0 +1,29 @@
+#include "driver/systick.h"
+#include "profiler.h"
+#include "scheduler.h"
+
+PROFILER_Task_t gProfilerTasks[PROFILER_COUNT];
+PROFILER_Tick_t gProfilerTick;
+
+void PROFILER_End(uint8_t Task, uint32_t Start)
+{
+	PROFILER_Task_t *pTask = &gProfilerTasks[Task];
+	const uint32_t Cycles = SCHEDULER_GetCycles() - Start;
+
+	if (pTask->Runs == 0 || Cycles < pTask->MinCycles) {
+		pTask->MinCycles = Cycles;
+	}
+	if (Cycles > pTask->MaxCycles) {
+		pTask->MaxCycles = Cycles;
+	}
+	if (Cycles >= SYSTICK_TICK_CYCLES) {
+		pTask->Overruns++;
+	}
+	if (pTask->Runs == 0) {
+		pTask->AvgCycles16 = Cycles << 4;
+	} else {
+		pTask->AvgCycles16 += Cycles - (pTask->AvgCycles16 >> 4);
+	}
+	pTask->Runs++;
+}
+
@@ -0,0 +1,61 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <stdint.h>
+
+#if defined(ENABLE_PROFILER)
+#include "scheduler.h"
+#endif
+
+enum {
+	PROFILER_APP_UPDATE = 0U,
+	PROFILER_CHECK_KEYS,
+	PROFILER_RADIO_INTERRUPTS,
+	PROFILER_UPDATE_SCREEN,
+	PROFILER_SCANNER,
+	PROFILER_SLICE_500MS,
+	PROFILER_COUNT,
+};
+
+// Tick handler entries later than this after the SysTick reload are late
+#define PROFILER_LATE_CYCLES 4800U
+
+typedef struct {
+	uint32_t Runs;
+	uint32_t MinCycles;
+	uint32_t MaxCycles;
+	uint32_t AvgCycles16; // Running average over ~16 runs, scaled by 16
+	uint32_t Overruns;    // Runs longer than one 10 ms tick
+} PROFILER_Task_t;
+
+typedef struct {
+	uint32_t Ticks;
+	uint32_t Late;
+	uint32_t MaxLatency;
+	uint32_t MissedSlots; // Ticks whose keys task had not run yet
+} PROFILER_Tick_t;
+
+#if defined(ENABLE_PROFILER)
+extern PROFILER_Task_t gProfilerTasks[PROFILER_COUNT];
+extern PROFILER_Tick_t gProfilerTick;
+
+void PROFILER_End(uint8_t Task, uint32_t Start);
+
+// Times Call while Pending holds, the tasks return early otherwise and
+// those passes would only drag the minimum down.
+#define PROFILE(Task, Pending, Call)                              \
+	do {                                                      \
+		if (Pending) {                                    \
+			const uint32_t Start = SCHEDULER_GetCycles(); \
+			Call;                                     \
+			PROFILER_End(Task, Start);                \
+		} else {                                          \
+			Call;                                     \
+		}                                                 \
+	} while (0)
+#else
+#define PROFILE(Task, Pending, Call) Call
+#endif
+
+#endif
+
@@ -17,6 +17,7 @@
  */
 
 #include <string.h>
+#include "ARMCM0.h"
 #include "app/dtmf.h"
 #if defined(ENABLE_FMRADIO)
 #include "app/fm.h"
@@ -27,6 +28,7 @@
 #include "driver/eeprom.h"
 #include "driver/gpio.h"
 #include "driver/system.h"
+#include "driver/systick.h"
 #include "frequencies.h"
 #include "functions.h"
 #include "helper/battery.h"
@@ -35,7 +37,9 @@
 #endif
 #include "misc.h"
 #include "radio.h"
+#include "scheduler.h"
 #include "settings.h"
+#include "timer.h"
 
 VFO_Info_t *gTxVfo;
 VFO_Info_t *gRxVfo;
@@ -49,70 +53,152 @@ STEP_Setting_t gStepSetting;
 
 VfoState_t VfoState[2];
 
-bool RADIO_CheckValidChannel(uint16_t Channel, bool bCheckScanList, uint8_t VFO)
+#if defined(ENABLE_PERF_STATS)
+RADIO_HopStats_t gRadioHopStats;
+#endif
+
+static RADIO_Profile_t gAppliedProfile;
+static bool gbProfileApplied;
+
+// Bit n of word n / 32 is set for every usable MR channel. The scan list
+// maps leave out that list's priority channels, which are checked first.
+static uint32_t gMR_ValidBits[MR_CHANNEL_WORDS];
+static uint32_t gMR_ScanListBits[2][MR_CHANNEL_WORDS];
+
+static const uint32_t *GetChannelBits(bool bCheckScanList, uint8_t VFO)
 {
-	uint8_t Attributes;
-	uint8_t PriorityCh1;
-	uint8_t PriorityCh2;
+	if (bCheckScanList && VFO < 2) {
+		return gMR_ScanListBits[VFO];
+	}
 
-	if (!IS_MR_CHANNEL(Channel)) {
-		return false;
+	return gMR_ValidBits;
+}
+
+static uint8_t FindBitUp(const uint32_t *pBits, uint8_t From)
+{
+	uint8_t Word = From / 32U;
+	uint32_t Bits = pBits[Word] & (0xFFFFFFFFU << (From % 32U));
+
+	while (Bits == 0) {
+		if (++Word == MR_CHANNEL_WORDS) {
+			return 0xFF;
+		}
+		Bits = pBits[Word];
 	}
 
-	// Check channel is valid
-	Attributes = gMR_ChannelAttributes[Channel];
+	return (Word * 32U) + __builtin_ctz(Bits);
+}
+
+static uint8_t FindBitDown(const uint32_t *pBits, uint8_t From)
+{
+	uint8_t Word = From / 32U;
+	uint32_t Bits = pBits[Word] & (0xFFFFFFFFU >> (31U - (From % 32U)));
+
+	while (Bits == 0) {
+		if (Word-- == 0) {
+			return 0xFF;
+		}
+		Bits = pBits[Word];
+	}
+
+	return (Word * 32U) + 31U - __builtin_clz(Bits);
+}
+
+void RADIO_UpdateChannelBits(uint8_t Channel)
+{
+	const uint8_t Attributes = gMR_ChannelAttributes[Channel];
+	const uint32_t Mask = 1U << (Channel % 32U);
+	const uint8_t Word = Channel / 32U;
+	uint8_t i;
+
+	gMR_ValidBits[Word] &= ~Mask;
+	gMR_ScanListBits[0][Word] &= ~Mask;
+	gMR_ScanListBits[1][Word] &= ~Mask;
+
 	if ((Attributes & MR_CH_BAND_MASK) > BAND7_470MHz) {
-		return false;
+		return;
 	}
-	
-	if (bCheckScanList) {
-		switch (VFO) {
-		case 0:
-			if ((Attributes & MR_CH_SCANLIST1) == 0) {
-				return false;
-			}
-			PriorityCh1 = gEeprom.SCANLIST_PRIORITY_CH1[0];
-			PriorityCh2 = gEeprom.SCANLIST_PRIORITY_CH2[0];
-			break;
-		case 1:
-			if ((Attributes & MR_CH_SCANLIST2) == 0) {
-				return false;
-			}
-			PriorityCh1 = gEeprom.SCANLIST_PRIORITY_CH1[1];
-			PriorityCh2 = gEeprom.SCANLIST_PRIORITY_CH2[1];
-			break;
-		default:
-			return true;
-		}
-		if (PriorityCh1 == Channel) {
-			return false;
+	gMR_ValidBits[Word] |= Mask;
+
+	for (i = 0; i < 2; i++) {
+		if ((Attributes & (MR_CH_SCANLIST1 >> i)) == 0) {
+			continue;
 		}
-		if (PriorityCh2 == Channel) {
-			return false;
+		if (Channel == gEeprom.SCANLIST_PRIORITY_CH1[i] || Channel == gEeprom.SCANLIST_PRIORITY_CH2[i]) {
+			continue;
 		}
+		gMR_ScanListBits[i][Word] |= Mask;
 	}
+}
 
-	return true;
+void RADIO_InitChannelBits(void)
+{
+	uint8_t i;
+
+	for (i = MR_CHANNEL_FIRST; i <= MR_CHANNEL_LAST; i++) {
+		RADIO_UpdateChannelBits(i);
+	}
+}
+
+bool RADIO_CheckValidChannel(uint16_t Channel, bool bCheckScanList, uint8_t VFO)
+{
+	const uint32_t *pBits;
+
+	if (!IS_MR_CHANNEL(Channel)) {
+		return false;
+	}
+
+	pBits = GetChannelBits(bCheckScanList, VFO);
+
+	return (pBits[Channel / 32U] >> (Channel % 32U)) & 1U;
 }
 
 uint8_t RADIO_FindNextChannel(uint8_t Channel, int8_t Direction, bool bCheckScanList, uint8_t VFO)
 {
-	uint8_t i;
+	const uint32_t *pBits = GetChannelBits(bCheckScanList, VFO);
+	uint8_t Found;
+
+	if (Channel == 0xFF) {
+		Channel = MR_CHANNEL_LAST;
+	} else if (Channel > MR_CHANNEL_LAST) {
+		Channel = MR_CHANNEL_FIRST;
+	}
 
-	for (i = 0; i <= MR_CHANNEL_LAST; i++) {
-		if (Channel == 0xFF) {
-			Channel = MR_CHANNEL_LAST;
-		} else if (Channel > MR_CHANNEL_LAST) {
-			Channel = MR_CHANNEL_FIRST;
+	// Search to the end of the table, then wrap around
+	if (Direction > 0) {
+		Found = FindBitUp(pBits, Channel);
+		if (Found == 0xFF) {
+			Found = FindBitUp(pBits, MR_CHANNEL_FIRST);
 		}
-		if (RADIO_CheckValidChannel(Channel, bCheckScanList, VFO)) {
-			return Channel;
+	} else {
+		Found = FindBitDown(pBits, Channel);
+		if (Found == 0xFF) {
+			Found = FindBitDown(pBits, MR_CHANNEL_LAST);
 		}
-		Channel += Direction;
 	}
 
-	return 0xFF;
+	return Found;
+}
+
+#if defined(ENABLE_PERF_STATS)
+uint32_t RADIO_BenchmarkFindNext(void)
+{
+	volatile uint8_t Found;
+	uint32_t Cycles;
+	uint32_t Start;
+	uint8_t i;
+
+	Cycles = 0;
+	for (i = MR_CHANNEL_FIRST; i <= MR_CHANNEL_LAST; i++) {
+		Start = SysTick->VAL;
+		Found = RADIO_FindNextChannel(i, RADIO_CHANNEL_UP, true, 0);
+		Cycles += SYSTICK_ElapsedCycles(Start);
+	}
+	(void)Found;
+
+	return Cycles;
 }
+#endif
 
 void RADIO_InitInfo(VFO_Info_t *pInfo, uint8_t ChannelSave, uint8_t Band, uint32_t Frequency)
 {
@@ -140,6 +226,10 @@ void RADIO_ConfigureChannel(uint8_t VFO, uint32_t Configure)
 	bool bParticipation2;
 	uint16_t Base;
 	uint32_t Frequency;
+#if defined(ENABLE_PERF_STATS)
+	const uint32_t StartUs = SCHEDULER_GetTimeUs();
+	uint32_t Delta;
+#endif
 
 	pRadio = &gVFO.Info[VFO];
 
@@ -193,52 +283,20 @@ void RADIO_ConfigureChannel(uint8_t VFO, uint32_t Configure)
 	gVFO.Info[VFO].SCANLIST2_PARTICIPATION = bParticipation2;
 	gVFO.Info[VFO].CHANNEL_SAVE = Channel;
 
-	if (IS_MR_CHANNEL(Channel)) {
-		Base = Channel * 16;
-	} else {
-		Base = 0x0C80 + ((Channel - FREQ_CHANNEL_FIRST) * 32) + (VFO * 16);
-	}
-
-	uint8_t Data[8];
-	memset(Data, 0, sizeof(Data));
-
 	if (Configure == VFO_CONFIGURE_RELOAD || Channel >= FREQ_CHANNEL_FIRST) {
-		struct {
-			uint32_t Frequency;
-			uint32_t Offset;
-		} Info;
-		EEPROM_ReadBuffer(Base, &Info, sizeof(Info));
+		MR_Channel_t Info;
 
-		gVFO.Info[VFO].ConfigRX.Frequency = Info.Frequency;
-		gVFO.Info[VFO].FREQUENCY_OF_DEVIATION = Info.Offset;
-
-		EEPROM_ReadBuffer(Base + 8, Data, 8);
-
-		gVFO.Info[VFO].ConfigRX.Code = Data[0];
-		gVFO.Info[VFO].ConfigTX.Code = Data[1];
-
-		gVFO.Info[VFO].ConfigRX.CodeType = (Data[2] & 0x0F);
-		gVFO.Info[VFO].ConfigTX.CodeType = (Data[2] >> 4) & 0x0F;
-
-		// Non-stock memory layout from now on
-		gVFO.Info[VFO].FREQUENCY_DEVIATION_SETTING = (Data[3] & 3);
-		gVFO.Info[VFO].FrequencyReverse = (Data[3] >> 4) & 1;
-
-		gVFO.Info[VFO].CHANNEL_BANDWIDTH = (Data[4] & 3);
-		gVFO.Info[VFO].OUTPUT_POWER = (Data[4] >> 2) & 3;
-		gVFO.Info[VFO].BUSY_CHANNEL_LOCK = (Data[4] >> 4) & 1;
-
-		gVFO.Info[VFO].DTMF_DECODING_ENABLE = (Data[5] & 1);
-		gVFO.Info[VFO].DTMF_PTT_ID_TX_MODE = (Data[5] >> 1) & 3;
-
-		gVFO.Info[VFO].STEP_SETTING = Data[6];
-		gVFO.Info[VFO].StepFrequency = StepFrequencyTable[Data[6]];
+		// MR channels come from the RAM index, VFOs keep their own slots
+		if (IS_MR_CHANNEL(Channel)) {
+			Info = gMR_Channels[Channel];
+		} else {
+			uint32_t Record[4];
 
-		gVFO.Info[VFO].CompanderMode = (Data[7] & 3);
-		gVFO.Info[VFO].MODULATION_MODE = (Data[7] >> 2) & 3;
-#if defined (ENABLE_MDC1200)
-		gVFO.Info[VFO].MDC1200_MODE = (Data[7] >> 4) & 3;
-#endif
+			Base = 0x0C80 + ((Channel - FREQ_CHANNEL_FIRST) * 32) + (VFO * 16);
+			EEPROM_ReadBuffer(Base, Record, sizeof(Record));
+			RADIO_PackChannel(&Info, Record[0], Record[1], (const uint8_t *)&Record[2]);
+		}
+		RADIO_UnpackChannel(pRadio, &Info);
 	}
 
 	Frequency = gVFO.Info[VFO].ConfigRX.Frequency;
@@ -257,13 +315,8 @@ void RADIO_ConfigureChannel(uint8_t VFO, uint32_t Configure)
 		gVFO.Info[VFO].FREQUENCY_OF_DEVIATION = Frequency;
 	}
 	RADIO_ApplyOffset(pRadio);
-	if (IS_MR_CHANNEL(Channel)) {
-		memset(gVFO.Info[VFO].Name, 0, sizeof(gVFO.Info[VFO].Name));
-		EEPROM_ReadBuffer(0x0F50 + (Channel * 0x10), gVFO.Info[VFO].Name, 16);
-		// 16 bytes allocated but only 12 used
-		//EEPROM_ReadBuffer(0x0F50 + (Channel * 0x10), gVFO.Info[VFO].Name + 0, 8);
-		//EEPROM_ReadBuffer(0x0F58 + (Channel * 0x10), gVFO.Info[VFO].Name + 8, 8);
-	}
+	// Names are only needed by the display, see RADIO_GetChannelName()
+	gVFO.Info[VFO].bNameLoaded = false;
 
 	if (!gVFO.Info[VFO].FrequencyReverse) {
 		gVFO.Info[VFO].pRX = &gVFO.Info[VFO].ConfigRX;
@@ -289,6 +342,107 @@ void RADIO_ConfigureChannel(uint8_t VFO, uint32_t Configure)
 	}
 
 	RADIO_ConfigureSquelchAndOutputPower(pRadio);
+
+#if defined(ENABLE_PERF_STATS)
+	Delta = SCHEDULER_GetTimeUs() - StartUs;
+	gRadioHopStats.Configures++;
+	gRadioHopStats.ConfigureTotalUs += Delta;
+	if (gRadioHopStats.ConfigureMaxUs < Delta) {
+		gRadioHopStats.ConfigureMaxUs = Delta;
+	}
+#endif
+}
+
+// Frequency and Offset are clamped to 27 bits, which is above every band
+// so the limits in RADIO_ConfigureChannel() still apply. Code types and
+// steps past the end of their tables are replaced, the decode used to
+// index StepFrequencyTable with them.
+void RADIO_PackChannel(MR_Channel_t *pChannel, uint32_t Frequency, uint32_t Offset, const uint8_t *pData)
+{
+	uint32_t RxCodeType = pData[2] & 0x0F;
+	uint32_t TxCodeType = (pData[2] >> 4) & 0x0F;
+	uint16_t Step = pData[6];
+
+	if (Frequency > MR_CHANNEL_FREQUENCY_MASK) {
+		Frequency = MR_CHANNEL_FREQUENCY_MASK;
+	}
+	if (Offset > MR_CHANNEL_FREQUENCY_MASK) {
+		Offset = MR_CHANNEL_FREQUENCY_MASK;
+	}
+	if (RxCodeType > CODE_TYPE_REVERSE_DIGITAL) {
+		RxCodeType = CODE_TYPE_OFF;
+	}
+	if (TxCodeType > CODE_TYPE_REVERSE_DIGITAL) {
+		TxCodeType = CODE_TYPE_OFF;
+	}
+	if (Step > STEP_8_33kHz) {
+		Step = STEP_12_5kHz;
+	}
+
+	pChannel->Frequency = Frequency
+		| (RxCodeType << 27)
+		| (TxCodeType << 29)
+		| ((uint32_t)((pData[3] >> 4) & 1) << 31);
+	pChannel->Offset = Offset
+		| ((uint32_t)(pData[4] & 3) << 27)
+		| ((uint32_t)((pData[4] >> 2) & 3) << 29)
+		| ((uint32_t)((pData[4] >> 4) & 1) << 31);
+	pChannel->Code[0] = pData[0];
+	pChannel->Code[1] = pData[1];
+	pChannel->Flags = (pData[3] & 3)
+		| ((pData[5] & 7) << 2)
+		| (Step << 5)
+		| ((pData[7] & 0x3F) << 8);
+}
+
+void RADIO_UnpackChannel(VFO_Info_t *pInfo, const MR_Channel_t *pChannel)
+{
+	const uint32_t Frequency = pChannel->Frequency;
+	const uint32_t Offset = pChannel->Offset;
+	const uint16_t Flags = pChannel->Flags;
+
+	pInfo->ConfigRX.Frequency = Frequency & MR_CHANNEL_FREQUENCY_MASK;
+	pInfo->FREQUENCY_OF_DEVIATION = Offset & MR_CHANNEL_FREQUENCY_MASK;
+
+	pInfo->ConfigRX.Code = pChannel->Code[0];
+	pInfo->ConfigTX.Code = pChannel->Code[1];
+
+	pInfo->ConfigRX.CodeType = (Frequency >> 27) & 3;
+	pInfo->ConfigTX.CodeType = (Frequency >> 29) & 3;
+	pInfo->FrequencyReverse = Frequency >> 31;
+
+	pInfo->CHANNEL_BANDWIDTH = (Offset >> 27) & 3;
+	pInfo->OUTPUT_POWER = (Offset >> 29) & 3;
+	pInfo->BUSY_CHANNEL_LOCK = Offset >> 31;
+
+	pInfo->FREQUENCY_DEVIATION_SETTING = Flags & 3;
+	pInfo->DTMF_DECODING_ENABLE = (Flags >> 2) & 1;
+	pInfo->DTMF_PTT_ID_TX_MODE = (Flags >> 3) & 3;
+
+	pInfo->STEP_SETTING = (Flags >> 5) & 7;
+	pInfo->StepFrequency = StepFrequencyTable[pInfo->STEP_SETTING];
+
+	pInfo->CompanderMode = (Flags >> 8) & 3;
+	pInfo->MODULATION_MODE = (Flags >> 10) & 3;
+#if defined (ENABLE_MDC1200)
+	pInfo->MDC1200_MODE = (Flags >> 12) & 3;
+#endif
+}
+
+const char *RADIO_GetChannelName(uint8_t VFO)
+{
+	VFO_Info_t *pInfo = &gVFO.Info[VFO];
+
+	if (!pInfo->bNameLoaded) {
+		memset(pInfo->Name, 0, sizeof(pInfo->Name));
+		if (IS_MR_CHANNEL(pInfo->CHANNEL_SAVE)) {
+			// 16 bytes allocated but only 12 used
+			EEPROM_ReadBuffer(0x0F50 + (pInfo->CHANNEL_SAVE * 0x10), pInfo->Name, 16);
+		}
+		pInfo->bNameLoaded = true;
+	}
+
+	return pInfo->Name;
 }
 
 void RADIO_ConfigureSquelchAndOutputPower(VFO_Info_t *pInfo)
@@ -345,6 +499,8 @@ void RADIO_ConfigureSquelchAndOutputPower(VFO_Info_t *pInfo)
 				MiddleFrequencyBandTable[Band],
 				UpperLimitFrequencyBandTable[Band],
 				pInfo->pTX->Frequency);
+
+	RADIO_BuildProfile(pInfo);
 }
 
 void RADIO_ApplyOffset(VFO_Info_t *pInfo)
@@ -408,21 +564,91 @@ void RADIO_SelectVfos(void)
 	RADIO_SelectCurrentVfo();
 }
 
+void RADIO_BuildProfile(VFO_Info_t *pInfo)
+{
+	RADIO_Profile_t *pProfile = &pInfo->Profile;
+
+	pProfile->Bandwidth = pInfo->CHANNEL_BANDWIDTH;
+#if defined(ENABLE_DIGITAL_MODULATION)
+	if (pInfo->MODULATION_MODE == MOD_DIG) {
+		if (pProfile->Bandwidth == BK4819_FILTER_BW_WIDE) {
+			pProfile->Bandwidth = BK4819_FILTER_BW_DIGITAL_WIDE;
+		} else {
+			pProfile->Bandwidth = BK4819_FILTER_BW_DIGITAL_NARROW;
+		}
+	}
+#endif
+	pProfile->Frequency = pInfo->pRX->Frequency;
+	pProfile->Modulation = pInfo->MODULATION_MODE;
+	pProfile->CodeType = pInfo->pRX->CodeType;
+	pProfile->Code = pInfo->pRX->Code;
+	pProfile->SquelchOpenRSSI = pInfo->SquelchOpenRSSI;
+	pProfile->SquelchCloseRSSI = pInfo->SquelchCloseRSSI;
+	pProfile->SquelchOpenNoise = pInfo->SquelchOpenNoise;
+	pProfile->SquelchCloseNoise = pInfo->SquelchCloseNoise;
+	pProfile->SquelchCloseGlitch = pInfo->SquelchCloseGlitch;
+	pProfile->SquelchOpenGlitch = pInfo->SquelchOpenGlitch;
+}
+
+// Anything that programs the BK4819 outside of RADIO_SetupRegisters must
+// call this so the next setup does not trust the last applied profile.
+void RADIO_InvalidateProfile(void)
+{
+	gbProfileApplied = false;
+}
+
+static uint8_t RADIO_DiffProfile(const RADIO_Profile_t *pProfile)
+{
+	const RADIO_Profile_t *pApplied = &gAppliedProfile;
+	uint8_t Changed = 0;
+
+	if (!gbProfileApplied) {
+		return RADIO_PROFILE_ALL;
+	}
+	if (pProfile->Bandwidth != pApplied->Bandwidth) {
+		Changed |= RADIO_PROFILE_BANDWIDTH;
+	}
+	if (pProfile->Frequency != pApplied->Frequency) {
+		Changed |= RADIO_PROFILE_FREQUENCY;
+	}
+	if (memcmp(&pProfile->SquelchOpenRSSI, &pApplied->SquelchOpenRSSI, 6) != 0) {
+		Changed |= RADIO_PROFILE_SQUELCH;
+	}
+	if (pProfile->Modulation != pApplied->Modulation) {
+		Changed |= RADIO_PROFILE_CSS | RADIO_PROFILE_AGC;
+	}
+	if (pProfile->CodeType != pApplied->CodeType || pProfile->Code != pApplied->Code) {
+		Changed |= RADIO_PROFILE_CSS;
+	}
+
+	return Changed;
+}
+
 void RADIO_SetupRegisters(bool bSwitchToFunction0)
 {
+	RADIO_Profile_t Profile;
 	uint16_t Status;
 	uint16_t InterruptMask;
-	uint32_t Frequency;
+	uint8_t Changed;
+	bool bRetuned = false;
+#if defined(ENABLE_PERF_STATS)
+	const uint32_t StartUs = SCHEDULER_GetTimeUs();
+	const uint32_t StartWrites = gBK4819_BusStats.Writes;
+	uint32_t Delta;
+#endif
+
+	Profile = gRxVfo->Profile;
+	if (gCssScanMode != CSS_SCAN_MODE_OFF) {
+		Profile.CodeType = gSelectedCodeType;
+		Profile.Code = gSelectedCode;
+	}
+	Changed = RADIO_DiffProfile(&Profile);
 
-	BK4819_FilterBandwidth_t Bandwidth = gRxVfo->CHANNEL_BANDWIDTH;
 #if defined(ENABLE_DIGITAL_MODULATION)
-	if (gRxVfo->MODULATION_MODE == MOD_DIG) {
-		if (Bandwidth == BK4819_FILTER_BW_WIDE) {
-			Bandwidth = BK4819_FILTER_BW_DIGITAL_WIDE;
-		} else {
-			Bandwidth = BK4819_FILTER_BW_DIGITAL_NARROW;
+	if (Profile.Modulation == MOD_DIG) {
+		if (Changed & RADIO_PROFILE_BANDWIDTH) {
+			BK4819_SetFilterBandwidth(Profile.Bandwidth, false);
 		}
-		BK4819_SetFilterBandwidth(Bandwidth, false);
 	} else
 	// Do not turn off the audio path for digital modulation.
 	// This is needed to reduce turn-around time.
@@ -431,7 +657,9 @@ void RADIO_SetupRegisters(bool bSwitchToFunction0)
 		GPIO_ClearBit(&GPIOC->DATA, GPIOC_PIN_AUDIO_PATH);
 		gEnableSpeaker = false;
 		BK4819_ClearGpioOut(BK4819_GPIO6_PIN2_GREEN);
-		BK4819_SetFilterBandwidth(Bandwidth, true);
+		if (Changed & RADIO_PROFILE_BANDWIDTH) {
+			BK4819_SetFilterBandwidth(Profile.Bandwidth, true);
+		}
 	}
 
 	BK4819_ClearGpioOut(BK4819_GPIO5_PIN1_RED);
@@ -447,20 +675,38 @@ void RADIO_SetupRegisters(bool bSwitchToFunction0)
 	}
 	BK4819_WriteRegister(BK4819_REG_3F, 0);
 #if defined(ENABLE_DIGITAL_MODULATION)
-	if (gRxVfo->MODULATION_MODE == MOD_DIG) {
+	if (Profile.Modulation == MOD_DIG) {
 		BK4819_WriteRegister(BK4819_REG_7D, 0xE940);
 	} else
 #endif
 	{
 		BK4819_WriteRegister(BK4819_REG_7D, gEeprom.MIC_SENSITIVITY_TUNING | 0xE940);
 	}
-	Frequency = gRxVfo->pRX->Frequency;
-	BK4819_SetFrequency(Frequency);
-	BK4819_SetupSquelch(
-			gRxVfo->SquelchOpenRSSI, gRxVfo->SquelchCloseRSSI,
-			gRxVfo->SquelchOpenNoise, gRxVfo->SquelchCloseNoise,
-			gRxVfo->SquelchCloseGlitch, gRxVfo->SquelchOpenGlitch);
-	BK4819_SelectFilter(Frequency);
+	if (Changed & RADIO_PROFILE_FREQUENCY) {
+#if defined(ENABLE_FAST_RETUNE)
+		// A plain frequency hop can leave the running RX link alone
+		if (Changed == RADIO_PROFILE_FREQUENCY && BK4819_FastRetune(Profile.Frequency)) {
+			bRetuned = true;
+		} else
+#endif
+		{
+			BK4819_SetFrequency(Profile.Frequency);
+		}
+	}
+	if (Changed & RADIO_PROFILE_SQUELCH) {
+		BK4819_SetupSquelch(
+				Profile.SquelchOpenRSSI, Profile.SquelchCloseRSSI,
+				Profile.SquelchOpenNoise, Profile.SquelchCloseNoise,
+				Profile.SquelchCloseGlitch, Profile.SquelchOpenGlitch);
+	} else if (!bRetuned) {
+		// Thresholds are already in place, only restart the receiver
+		BK4819_WriteRegister(BK4819_REG_70, 0);
+		BK4819_SetAF(BK4819_AF_MUTE);
+		BK4819_RX_TurnOn();
+	}
+	if ((Changed & RADIO_PROFILE_FREQUENCY) && !bRetuned) {
+		BK4819_SelectFilter(Profile.Frequency);
+	}
 	BK4819_SetGpioOut(BK4819_GPIO0_PIN28_RX_ENABLE);
 	BK4819_WriteRegister(BK4819_REG_48, 0xB3A8);
 
@@ -469,20 +715,13 @@ void RADIO_SetupRegisters(bool bSwitchToFunction0)
 		| BK4819_REG_3F_SQUELCH_LOST
 		;
 
-	if (gRxVfo->MODULATION_MODE == MOD_FM) {
-		uint8_t CodeType;
-		uint8_t Code;
-
-		CodeType = gSelectedCodeType;
-		Code = gSelectedCode;
-		if (gCssScanMode == CSS_SCAN_MODE_OFF) {
-			CodeType = gRxVfo->pRX->CodeType;
-			Code = gRxVfo->pRX->Code;
-		}
-		switch (CodeType) {
+	if (Profile.Modulation == MOD_FM) {
+		switch (Profile.CodeType) {
 		case CODE_TYPE_DIGITAL:
 		case CODE_TYPE_REVERSE_DIGITAL:
-			BK4819_SetCDCSSCodeWord(DCS_GetGolayCodeWord(CodeType, Code));
+			if (Changed & RADIO_PROFILE_CSS) {
+				BK4819_SetCDCSSCodeWord(DCS_GetGolayCodeWord(Profile.CodeType, Profile.Code));
+			}
 			InterruptMask = 0
 				| BK4819_REG_3F_CxCSS_TAIL
 				| BK4819_REG_3F_CDCSS_FOUND
@@ -492,8 +731,10 @@ void RADIO_SetupRegisters(bool bSwitchToFunction0)
 				;
 			break;
 		case CODE_TYPE_CONTINUOUS_TONE:
-			BK4819_SetCTCSSFrequency(CTCSS_Options[Code]);
-			BK4819_Set55HzTailDetection();
+			if (Changed & RADIO_PROFILE_CSS) {
+				BK4819_SetCTCSSFrequency(CTCSS_Options[Profile.Code]);
+				BK4819_Set55HzTailDetection();
+			}
 			InterruptMask = 0
 				| BK4819_REG_3F_CxCSS_TAIL
 				| BK4819_REG_3F_CTCSS_FOUND
@@ -503,8 +744,10 @@ void RADIO_SetupRegisters(bool bSwitchToFunction0)
 				;
 			break;
 		default:
-			BK4819_SetCTCSSFrequency(670);
-			BK4819_Set55HzTailDetection();
+			if (Changed & RADIO_PROFILE_CSS) {
+				BK4819_SetCTCSSFrequency(670);
+				BK4819_Set55HzTailDetection();
+			}
 			InterruptMask = 0
 				| BK4819_REG_3F_CxCSS_TAIL
 				| BK4819_REG_3F_SQUELCH_FOUND
@@ -513,17 +756,19 @@ void RADIO_SetupRegisters(bool bSwitchToFunction0)
 			break;
 		}
 	}
-	BK4819_SetModulation(gRxVfo->MODULATION_MODE);
-	BK4819_SetAGC(gRxVfo->MODULATION_MODE);
+	BK4819_SetModulation(Profile.Modulation);
+	if (Changed & RADIO_PROFILE_AGC) {
+		BK4819_SetAGC(Profile.Modulation);
+	}
 
-	if (gRxVfo->MODULATION_MODE != MOD_FM || !gRxVfo->DTMF_DECODING_ENABLE) {
+	if (Profile.Modulation != MOD_FM || !gRxVfo->DTMF_DECODING_ENABLE) {
 		BK4819_DisableDTMF();
 #if defined(ENABLE_MDC1200)
 		BK4819_DisableMDC1200Rx();
 #endif
 	} else {
 #if defined(ENABLE_DIGITAL_MODULATION)
-	if (gRxVfo->MODULATION_MODE != MOD_DIG) {
+	if (Profile.Modulation != MOD_DIG) {
 #endif
 		BK4819_EnableDTMF();
 		InterruptMask |= BK4819_REG_3F_DTMF_5TONE_FOUND;
@@ -537,6 +782,19 @@ void RADIO_SetupRegisters(bool bSwitchToFunction0)
 	}
 	BK4819_WriteRegister(BK4819_REG_3F, InterruptMask);
 
+	gAppliedProfile = Profile;
+	gbProfileApplied = true;
+
+#if defined(ENABLE_PERF_STATS)
+	Delta = SCHEDULER_GetTimeUs() - StartUs;
+	gRadioHopStats.Hops++;
+	gRadioHopStats.Writes += gBK4819_BusStats.Writes - StartWrites;
+	gRadioHopStats.TotalUs += Delta;
+	if (gRadioHopStats.MaxUs < Delta) {
+		gRadioHopStats.MaxUs = Delta;
+	}
+#endif
+
 	FUNCTION_Init();
 
 	if (bSwitchToFunction0) {
@@ -547,6 +805,8 @@ void RADIO_SetupRegisters(bool bSwitchToFunction0)
 void RADIO_SetTxParameters(void)
 {
 	BK4819_FilterBandwidth_t Bandwidth = gCurrentVfo->CHANNEL_BANDWIDTH;
+
+	RADIO_InvalidateProfile();
 #if defined(ENABLE_DIGITAL_MODULATION)
 	if (gCurrentVfo->MODULATION_MODE == MOD_DIG) {
 		if (Bandwidth == BK4819_FILTER_BW_WIDE) {
@@ -638,7 +898,7 @@ void RADIO_SetVfoState(VfoState_t State)
 void RADIO_PrepareTX(void)
 {
 	if (gEeprom.DUAL_WATCH != DUAL_WATCH_OFF) {
-		gDualWatchCountdown = 360;
+		TIMER_Start(TIMER_DUAL_WATCH, 360);
 		gScheduleDualWatch = false;
 		if (!gRxVfoIsActive) {
 			gEeprom.RX_VFO = gEeprom.TX_VFO;
@@ -690,7 +950,8 @@ void RADIO_PrepareTX(void)
 		}
 	}
 	FUNCTION_Select(FUNCTION_TRANSMIT);
-	gTxTimerCountdown = gEeprom.TX_TIMEOUT_TIMER * 120;
+	// One minute per step
+	TIMER_Start(TIMER_TX_TIMEOUT, gEeprom.TX_TIMEOUT_TIMER * 6000);
 	gTxTimeoutReached = false;
 	gFlagEndTransmission = false;
 	gRTTECountdown = 0;
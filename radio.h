@@ -20,6 +20,7 @@
 #include <stdbool.h>
 #include <stdint.h>
 #include "dcs.h"
+#include "misc.h"
 
 enum {
 	MR_CH_SCANLIST1 = (1U << 7),
@@ -27,6 +28,9 @@ enum {
 	MR_CH_BAND_MASK = 0x0FU,
 };
 
+// 32 bit words needed for one bit per MR channel
+#define MR_CHANNEL_WORDS 7U
+
 enum {
 	RADIO_CHANNEL_UP = 0x01U,
 	RADIO_CHANNEL_DOWN = 0xFFU,
@@ -86,6 +90,43 @@ typedef struct {
 	uint8_t Code;
 } FREQ_Config_t;
 
+enum {
+	RADIO_PROFILE_BANDWIDTH = (1U << 0),
+	RADIO_PROFILE_FREQUENCY = (1U << 1),
+	RADIO_PROFILE_SQUELCH   = (1U << 2),
+	RADIO_PROFILE_CSS       = (1U << 3),
+	RADIO_PROFILE_AGC       = (1U << 4),
+	RADIO_PROFILE_ALL       = 0x1FU,
+};
+
+// BK4819 receive settings derived from a VFO, compared group by group so
+// that RADIO_SetupRegisters only reprograms what differs from the chip
+typedef struct {
+	uint32_t Frequency;
+	uint8_t Bandwidth;
+	uint8_t Modulation;
+	uint8_t CodeType;
+	uint8_t Code;
+	uint8_t SquelchOpenRSSI;
+	uint8_t SquelchCloseRSSI;
+	uint8_t SquelchOpenNoise;
+	uint8_t SquelchCloseNoise;
+	uint8_t SquelchCloseGlitch;
+	uint8_t SquelchOpenGlitch;
+} RADIO_Profile_t;
+
+#if defined(ENABLE_PERF_STATS)
+typedef struct {
+	uint32_t Hops;
+	uint32_t Writes;
+	uint32_t TotalUs;
+	uint32_t MaxUs;
+	uint32_t Configures;
+	uint32_t ConfigureTotalUs;
+	uint32_t ConfigureMaxUs;
+} RADIO_HopStats_t;
+#endif
+
 typedef struct VFO_Info_t {
 	FREQ_Config_t ConfigRX;
 	FREQ_Config_t ConfigTX;
@@ -116,6 +157,8 @@ typedef struct VFO_Info_t {
 	uint8_t MDC1200_MODE;
 	bool FrequencyReverse;
 	char Name[16];
+	bool bNameLoaded;
+	RADIO_Profile_t Profile;
 } VFO_Info_t;
 
 extern VFO_Info_t *gTxVfo;
@@ -130,13 +173,26 @@ extern STEP_Setting_t gStepSetting;
 
 extern VfoState_t VfoState[2];
 
+#if defined(ENABLE_PERF_STATS)
+extern RADIO_HopStats_t gRadioHopStats;
+
+uint32_t RADIO_BenchmarkFindNext(void);
+#endif
+
+void RADIO_UpdateChannelBits(uint8_t Channel);
+void RADIO_InitChannelBits(void);
 bool RADIO_CheckValidChannel(uint16_t ChNum, bool bCheckScanList, uint8_t RadioNum);
 uint8_t RADIO_FindNextChannel(uint8_t ChNum, int8_t Direction, bool bCheckScanList, uint8_t RadioNum);
 void RADIO_InitInfo(VFO_Info_t *pInfo, uint8_t ChannelSave, uint8_t ChIndex, uint32_t Frequency);
 void RADIO_ConfigureChannel(uint8_t RadioNum, uint32_t Arg);
+void RADIO_PackChannel(MR_Channel_t *pChannel, uint32_t Frequency, uint32_t Offset, const uint8_t *pData);
+void RADIO_UnpackChannel(VFO_Info_t *pInfo, const MR_Channel_t *pChannel);
+const char *RADIO_GetChannelName(uint8_t VFO);
 void RADIO_ConfigureSquelchAndOutputPower(VFO_Info_t *pInfo);
 void RADIO_ApplyOffset(VFO_Info_t *pInfo);
 void RADIO_SelectVfos(void);
+void RADIO_BuildProfile(VFO_Info_t *pInfo);
+void RADIO_InvalidateProfile(void);
 void RADIO_SetupRegisters(bool bSwitchToFunction0);
 //void RADIO_ConfigureNOAA(void);
 void RADIO_SetTxParameters(void);
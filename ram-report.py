@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+
+# Lists the RAM taken by every .data/.bss symbol, grouped by object file,
+# from the linker map. Needs -fdata-sections so each symbol gets its own
+# input section, which is the default unless ENABLE_LTO is set.
+
+import re
+import sys
+
+RAM_START = 0x20000000
+RAM_SIZE = 16 * 1024
+
+SECTION = re.compile(r'^ (\.(?:sram)?(?:data|bss|sramtext)\S*|COMMON)(?:\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S+))?\s*$')
+CONTINUATION = re.compile(r'^\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S+)\s*$')
+
+def parse(path):
+    modules = {}
+    pending = None
+    in_map = False
+
+    for line in open(path):
+        if line.startswith('Linker script and memory map'):
+            in_map = True
+            continue
+        if not in_map:
+            continue
+
+        if pending is not None:
+            match = CONTINUATION.match(line)
+            if match:
+                add(modules, pending, *match.groups())
+            pending = None
+            continue
+
+        match = SECTION.match(line)
+        if not match:
+            continue
+        name, address, size, module = match.groups()
+        if address is None:
+            # Long section names put the address on the next line
+            pending = name
+        else:
+            add(modules, name, address, size, module)
+
+    return modules
+
+def add(modules, name, address, size, module):
+    address = int(address, 16)
+    size = int(size, 16)
+    if size == 0 or address < RAM_START or address >= RAM_START + RAM_SIZE:
+        return
+
+    kind = 'bss' if 'bss' in name or name == 'COMMON' else 'data'
+    symbol = name.split('.', 2)[2] if name.count('.') >= 2 else name
+    modules.setdefault(module, []).append((size, kind, symbol))
+
+if len(sys.argv) != 2:
+    print('Usage: ram-report.py <firmware.map>')
+    sys.exit(1)
+
+modules = parse(sys.argv[1])
+totals = { 'data': 0, 'bss': 0 }
+
+for module, symbols in sorted(modules.items(), key=lambda m: -sum(s[0] for s in m[1])):
+    print('%6d  %s' % (sum(s[0] for s in symbols), module))
+    for size, kind, symbol in sorted(symbols, reverse=True):
+        print('%6d    %-4s %s' % (size, kind, symbol))
+        totals[kind] += size
+
+used = totals['data'] + totals['bss']
+print()
+print('%6d  .data' % totals['data'])
+print('%6d  .bss' % totals['bss'])
+print('%6d  left for the stack' % (RAM_SIZE - used))
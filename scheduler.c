@@ -14,33 +14,19 @@
  *     limitations under the License.
  */
 
-#if defined(ENABLE_FMRADIO)
-#include "app/fm.h"
-#endif
+#include "ARMCM0.h"
 #include "app/scanner.h"
+#include "driver/bk4819.h"
+#include "driver/systick.h"
 #include "functions.h"
-#include "helper/battery.h"
 #include "misc.h"
+#if defined(ENABLE_PROFILER)
+#include "profiler.h"
+#endif
 #include "scheduler.h"
-#include "settings.h"
+#include "timer.h"
 #include "ui/ui.h"
 
-#define DECREMENT_AND_TRIGGER(cnt, flag) \
-	if (cnt > 0 && --cnt == 0) { \
-		flag = true; \
-	}
-#define INCREMENT_AND_TRIGGER(cnt, flag) \
-	if (cnt == 0 && ++cnt > 0) { \
-		flag = false; \
-	}
-#define TRIGGER_CXCSS(cnt, flag0, flag1) \
-	if (cnt > 0 && --cnt == 0) { \
-		if (flag0) { \
-			flag1 = false; \
-			flag0 = false; \
-		} \
-	}
-
 static uint16_t SCHEDULER_Tasks;
 
 static void SetTask(uint16_t Task)
@@ -58,69 +44,238 @@ void SCHEDULER_ClearTask(uint16_t Task)
 	SCHEDULER_Tasks &= ~Task;
 }
 
-static volatile uint32_t gGlobalSysTickCounter;
+static void OnSlice40ms(void)
+{
+	gNextTimeslice40ms = true;
+}
 
-void SystickHandler(void);
+static void OnSlice500ms(void)
+{
+	gNextTimeslice500ms = true;
+	SetTask(TASK_FM_RADIO);
+}
 
-void SystickHandler(void)
+static void OnTxTimeout(void)
 {
-	gGlobalSysTickCounter++;
+	gTxTimeoutReached = true;
+}
 
-	SetTask(TASK_CHECK_KEYS);
-	SetTask(TASK_CHECK_RADIO_INTERRUPTS);
-	if (gCurrentFunction != FUNCTION_TRANSMIT || gRequestDisplayScreen != DISPLAY_INVALID) {
-		SetTask(TASK_UPDATE_SCREEN);
+static void OnPowerSave(void)
+{
+	gSchedulePowerSave = true;
+}
+
+static void OnBatterySave(void)
+{
+	gBatterySaveCountdownExpired = true;
+}
+
+static void OnDualWatch(void)
+{
+	gScheduleDualWatch = true;
+}
+
+static void OnScanPause(void)
+{
+	gScheduleScanListen = true;
+}
+
+static void OnTailNote(void)
+{
+	gFlagTteComplete = true;
+}
+
+static void OnFoundCtcss(void)
+{
+	if (gFoundCTCSS) {
+		gFoundCDCSS = false;
+		gFoundCTCSS = false;
 	}
+}
 
-	if ((gGlobalSysTickCounter & 3) == 0) {
-		gNextTimeslice40ms = true;
+static void OnFoundCdcss(void)
+{
+	if (gFoundCDCSS) {
+		gFoundCTCSS = false;
+		gFoundCDCSS = false;
 	}
-	if ((gGlobalSysTickCounter % 21) == 0) {
-		SetTask(TASK_SCANNER);
+}
+
+#define IN(Function) (1U << (Function))
+#define IN_ANY_FUNCTION 0xFFU
+
+// The mode masks stand in for the checks the tick handler used to make
+// before each decrement. Scan and dual watch state is checked again by
+// whoever consumes the flag.
+const TIMER_Config_t gTimerConfig[TIMER_COUNT] = {
+	[TIMER_SLICE_40MS]   = { OnSlice40ms,    4, IN(FUNCTION_INCOMING) | IN(FUNCTION_RECEIVE) },
+	[TIMER_SLICE_500MS]  = { OnSlice500ms,  50, IN_ANY_FUNCTION },
+	[TIMER_TX_TIMEOUT]   = { OnTxTimeout,    0, IN_ANY_FUNCTION },
+	[TIMER_POWER_SAVE]   = { OnPowerSave,    0, IN(FUNCTION_FOREGROUND) },
+	[TIMER_BATTERY_SAVE] = { OnBatterySave,  0, IN(FUNCTION_POWER_SAVE) },
+	[TIMER_DUAL_WATCH]   = { OnDualWatch,    0, IN(FUNCTION_FOREGROUND) | IN(FUNCTION_INCOMING) | IN(FUNCTION_POWER_SAVE) },
+	[TIMER_SCAN_PAUSE]   = { OnScanPause,    0, IN(FUNCTION_FOREGROUND) | IN(FUNCTION_INCOMING) | IN(FUNCTION_RECEIVE) | IN(FUNCTION_POWER_SAVE) },
+	[TIMER_TAIL_NOTE]    = { OnTailNote,     0, IN_ANY_FUNCTION },
+	[TIMER_FOUND_CTCSS]  = { OnFoundCtcss,   0, IN_ANY_FUNCTION },
+	[TIMER_FOUND_CDCSS]  = { OnFoundCdcss,   0, IN_ANY_FUNCTION },
+};
+
+void SCHEDULER_Init(void)
+{
+	TIMER_Start(TIMER_SLICE_40MS, 4);
+	TIMER_Start(TIMER_SLICE_500MS, 50);
+	TIMER_Start(TIMER_POWER_SAVE, 1000);
+}
+
+static volatile uint32_t gGlobalSysTickCounter;
+
+// Ticks covered by the SysTick period that is running and by the one that
+// follows it. LOAD only takes effect on reload, so the two can differ.
+static volatile uint8_t gTickStride = 1;
+static uint8_t gTickStrideNext = 1;
+
+#if defined(ENABLE_PERF_STATS)
+SCHEDULER_SleepStats_t gSchedulerSleepStats;
+static uint32_t gSleepCycles;
+#endif
+
+uint32_t SCHEDULER_GetTimeUs(void)
+{
+	uint32_t Ticks;
+	uint32_t Stride;
+	uint32_t Value;
+
+	// Retry if the tick interrupt lands between the reads
+	do {
+		Ticks = gGlobalSysTickCounter;
+		Stride = gTickStride;
+		Value = SysTick->VAL;
+	} while (Ticks != gGlobalSysTickCounter);
+
+	return (Ticks * 10000U) + (((Stride * SYSTICK_TICK_CYCLES) - 1U - Value) / 48U);
+}
+
+#if defined(ENABLE_PROFILER)
+// Core cycles since boot. Wraps every 89 s, which is fine for differences.
+uint32_t SCHEDULER_GetCycles(void)
+{
+	uint32_t Ticks;
+	uint32_t Stride;
+	uint32_t Value;
+
+	do {
+		Ticks = gGlobalSysTickCounter;
+		Stride = gTickStride;
+		Value = SysTick->VAL;
+	} while (Ticks != gGlobalSysTickCounter);
+
+	return ((Ticks + Stride) * SYSTICK_TICK_CYCLES) - 1U - Value;
+}
+#endif
+
+// While the BK4819 sleeps between battery save wake ups nothing has to
+// happen before the next timer expires, so the ticks up to that point are
+// batched into one interrupt. The key scan still runs every few ticks.
+static uint8_t GetNextStride(void)
+{
+	if (gCurrentFunction == FUNCTION_POWER_SAVE && gRxIdleMode) {
+		const uint16_t Next = TIMER_GetNextExpiry();
+
+		if (Next > gTickStride) {
+			const uint16_t Remaining = Next - gTickStride;
+
+			return (Remaining < SCHEDULER_MAX_STRIDE) ? Remaining : SCHEDULER_MAX_STRIDE;
+		}
 	}
-	if ((gGlobalSysTickCounter % 50) == 0) {
-		gNextTimeslice500ms = true;
-		DECREMENT_AND_TRIGGER(gTxTimerCountdown, gTxTimeoutReached);
-		SetTask(TASK_FM_RADIO);
+
+	return 1;
+}
+
+void SCHEDULER_Sleep(void)
+{
+#if defined(ENABLE_PERF_STATS)
+	uint32_t Before;
+	uint32_t After;
+#endif
+
+	// Interrupts stay masked from the check to WFI so a task posted in
+	// between still wakes the core, it is only serviced once we are back.
+	__disable_irq();
+	if (SCHEDULER_Tasks == 0 && (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) == 0) {
+		const uint8_t Stride = GetNextStride();
+
+		if (Stride != gTickStrideNext) {
+			SysTick->LOAD = (Stride * SYSTICK_TICK_CYCLES) - 1U;
+			gTickStrideNext = Stride;
+		}
+#if defined(ENABLE_PERF_STATS)
+		Before = SysTick->VAL;
+#endif
+		__WFI();
+#if defined(ENABLE_PERF_STATS)
+		After = SysTick->VAL;
+		if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+			// Woken by the tick, so the counter reloaded on the way
+			gSleepCycles += Before + (gTickStrideNext * SYSTICK_TICK_CYCLES) - After;
+		} else {
+			gSleepCycles += Before - After;
+		}
+		gSchedulerSleepStats.SleepMs += gSleepCycles / 48000U;
+		gSleepCycles %= 48000U;
+		gSchedulerSleepStats.Wakeups++;
+#endif
 	}
+	__enable_irq();
+}
 
-	TRIGGER_CXCSS(gFoundCDCSSCountdown, gFoundCDCSS, gFoundCTCSS);
-	TRIGGER_CXCSS(gFoundCTCSSCountdown, gFoundCTCSS, gFoundCDCSS);
-
-	switch (gCurrentFunction) {
-	case FUNCTION_FOREGROUND:
-		DECREMENT_AND_TRIGGER(gBatterySaveCountdown, gSchedulePowerSave);
-		break;
-	case FUNCTION_POWER_SAVE:
-		DECREMENT_AND_TRIGGER(gBatterySave, gBatterySaveCountdownExpired);
-		break;
-	default:
-		break;
+#if defined(ENABLE_PERF_STATS)
+uint32_t SCHEDULER_GetUpTimeMs(void)
+{
+	return gGlobalSysTickCounter * 10U;
+}
+#endif
+
+static void Tick(void)
+{
+	gGlobalSysTickCounter++;
+	TIMER_Tick();
+}
+
+void SystickHandler(void);
+
+void SystickHandler(void)
+{
+	uint8_t Ticks = gTickStride;
+
+#if defined(ENABLE_PROFILER)
+	const uint32_t Latency = SysTick->LOAD - SysTick->VAL;
+
+	gProfilerTick.Ticks++;
+	if (Latency > gProfilerTick.MaxLatency) {
+		gProfilerTick.MaxLatency = Latency;
 	}
-	if (gScanState == SCAN_OFF && gCssScanMode == CSS_SCAN_MODE_OFF && gEeprom.DUAL_WATCH != DUAL_WATCH_OFF) {
-		switch (gCurrentFunction) {
-		case FUNCTION_FOREGROUND:
-		case FUNCTION_INCOMING:
-		case FUNCTION_POWER_SAVE:
-			DECREMENT_AND_TRIGGER(gDualWatchCountdown, gScheduleDualWatch);
-			break;
-		default:
-			break;
-		}
+	if (Latency > PROFILER_LATE_CYCLES) {
+		gProfilerTick.Late++;
 	}
-	if (gScanState != SCAN_OFF || gCssScanMode == CSS_SCAN_MODE_SCANNING) {
-		switch (gCurrentFunction) {
-		case FUNCTION_FOREGROUND:
-		case FUNCTION_INCOMING:
-		case FUNCTION_RECEIVE:
-		case FUNCTION_POWER_SAVE:
-			DECREMENT_AND_TRIGGER(ScanPauseDelayIn10msec, gScheduleScanListen);
-			break;
-		default:
-			break;
-		}
+	if (SCHEDULER_Tasks & TASK_CHECK_KEYS) {
+		gProfilerTick.MissedSlots++;
+	}
+#endif
+
+	gTickStride = gTickStrideNext;
+
+	SetTask(TASK_CHECK_KEYS);
+	SetTask(TASK_CHECK_RADIO_INTERRUPTS);
+	if (gCurrentFunction != FUNCTION_TRANSMIT || gRequestDisplayScreen != DISPLAY_INVALID) {
+		SetTask(TASK_UPDATE_SCREEN);
 	}
+	SetTask(TASK_SCANNER);
 
-	DECREMENT_AND_TRIGGER(gTailNoteEliminationCountdown, gFlagTteComplete);
+#if defined(ENABLE_PERF_STATS)
+	gSchedulerSleepStats.BatchedTicks += Ticks - 1;
+#endif
+	while (Ticks--) {
+		Tick();
+	}
 }
 
@@ -4,8 +4,13 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+// Most ticks batched into one SysTick period in power save. Keys are only
+// scanned once per period, so this bounds the wake up latency of a key.
+#ifndef SCHEDULER_MAX_STRIDE
+#define SCHEDULER_MAX_STRIDE 4U
+#endif
+
 enum {
-	TASK_SLEEP                  = 0x0000U,
 	TASK_UPDATE_SCREEN          = 0x0001U,
 	TASK_CHECK_KEYS             = 0x0002U,
 	TASK_CHECK_RADIO_INTERRUPTS = 0x0004U,
@@ -14,8 +19,29 @@ enum {
 	TASK_FM_RADIO               = 0x0020U,
 };
 
+#if defined(ENABLE_PERF_STATS)
+// Time spent in WFI. The average MCU current can be modelled as
+// I_run + (I_sleep - I_run) * SleepMs / UpTimeMs.
+typedef struct {
+	uint32_t SleepMs;
+	uint32_t Wakeups;
+	uint32_t BatchedTicks;
+} SCHEDULER_SleepStats_t;
+
+extern SCHEDULER_SleepStats_t gSchedulerSleepStats;
+#endif
+
 bool SCHEDULER_CheckTask(uint16_t Task);
 void SCHEDULER_ClearTask(uint16_t Task);
+uint32_t SCHEDULER_GetTimeUs(void);
+#if defined(ENABLE_PROFILER)
+uint32_t SCHEDULER_GetCycles(void);
+#endif
+#if defined(ENABLE_PERF_STATS)
+uint32_t SCHEDULER_GetUpTimeMs(void);
+#endif
+void SCHEDULER_Init(void);
+void SCHEDULER_Sleep(void);
 
 #endif
 
@@ -24,6 +24,7 @@
 #endif
 #include "helper/battery.h"
 #include "misc.h"
+#include "radio.h"
 #include "settings.h"
 
 EEPROM_Config_t gEeprom;
@@ -40,9 +41,9 @@ void SETTINGS_SaveFM(void)
 	UART_LogSend("sFm\r\n", 5);
 #endif
 
-	EEPROM_WriteBuffer(0x0E88, &gFM);
+	EEPROM_WriteDeferred(0x0E88, &gFM);
 	for (uint8_t i = 0; i < 5; i++) {
-		EEPROM_WriteBuffer(0x0E40 + (i * 8), &gFM_Channels[i * 4]);
+		EEPROM_WriteDeferred(0x0E40 + (i * 8), &gFM_Channels[i * 4]);
 	}
 }
 #endif
@@ -65,7 +66,7 @@ void SETTINGS_SaveVfoIndices(void)
 		State[i] = 0xFF;
 	}
 
-	EEPROM_WriteBuffer(0x0E80, State);
+	EEPROM_WriteDeferred(0x0E80, State);
 }
 
 void SETTINGS_SaveSettings(void)
@@ -87,7 +88,7 @@ void SETTINGS_SaveSettings(void)
 	}
 	State[7] = gEeprom.MIC_SENSITIVITY;
 
-	EEPROM_WriteBuffer(0x0E70, State);
+	EEPROM_WriteDeferred(0x0E70, State);
 
 	State[0] = 0xFF;
 	State[1] = gEeprom.CHANNEL_DISPLAY_MODE;
@@ -98,7 +99,7 @@ void SETTINGS_SaveSettings(void)
 	State[6] = gEeprom.TAIL_NOTE_ELIMINATION;
 	State[7] = gEeprom.VFO_OPEN;
 
-	EEPROM_WriteBuffer(0x0E78, State);
+	EEPROM_WriteDeferred(0x0E78, State);
 
 	//State[0] = 0xFF;
 	State[1] = gEeprom.KEY_1_SHORT_PRESS_ACTION;
@@ -107,19 +108,20 @@ void SETTINGS_SaveSettings(void)
 	State[4] = gEeprom.KEY_2_LONG_PRESS_ACTION;
 	State[5] = gEeprom.SCAN_RESUME_MODE;
 	State[6] = gEeprom.AUTO_KEYPAD_LOCK;
-	State[7] = 0xFF;
+	// Non-stock memory layout
+	State[7] = gEeprom.SCAN_ADAPTIVE_DWELL;
 
-	EEPROM_WriteBuffer(0x0E90, State);
+	EEPROM_WriteDeferred(0x0E90, State);
 
 	Buf[0] = gEeprom.POWER_ON_PASSWORD;
 	Buf[1] = 0xFF;
 
-	EEPROM_WriteBuffer(0x0E98, Buf);
+	EEPROM_WriteDeferred(0x0E98, Buf);
 
 	Buf[0] = gEeprom.MDC1200_ID;
 	//Buf[1] = 0xFF;
 
-	EEPROM_WriteBuffer(0x0EA0, Buf);
+	EEPROM_WriteDeferred(0x0EA0, Buf);
 
 	//State[0] = 0xFF;
 	State[1] = gEeprom.ROGER;
@@ -129,7 +131,7 @@ void SETTINGS_SaveSettings(void)
 		State[i] = 0xFF;
 	}
 
-	EEPROM_WriteBuffer(0x0EA8, State);
+	EEPROM_WriteDeferred(0x0EA8, State);
 
 	State[0] = gEeprom.DTMF_SIDE_TONE;
 	State[1] = gEeprom.DTMF_SEPARATE_CODE;
@@ -140,7 +142,7 @@ void SETTINGS_SaveSettings(void)
 	State[6] = gEeprom.DTMF_FIRST_CODE_PERSIST_TIME / 10U;
 	State[7] = gEeprom.DTMF_HASH_CODE_PERSIST_TIME / 10U;
 
-	EEPROM_WriteBuffer(0x0ED0, State);
+	EEPROM_WriteDeferred(0x0ED0, State);
 
 	memset(State, 0xFF, sizeof(State));
 
@@ -150,7 +152,7 @@ void SETTINGS_SaveSettings(void)
 		State[i] = 0xFF;
 	}
 
-	EEPROM_WriteBuffer(0x0ED8, State);
+	EEPROM_WriteDeferred(0x0ED8, State);
 
 	State[0] = gEeprom.SCAN_LIST_DEFAULT;
 	State[1] = gEeprom.SCAN_LIST_ENABLED[0];
@@ -161,7 +163,7 @@ void SETTINGS_SaveSettings(void)
 	State[6] = gEeprom.SCANLIST_PRIORITY_CH2[1];
 	State[7] = 0xFF;
 
-	EEPROM_WriteBuffer(0x0F18, State);
+	EEPROM_WriteDeferred(0x0F18, State);
 
 	State[0] = gSetting_F_LOCK;
 	State[1] = gSetting_350TX;
@@ -172,12 +174,12 @@ void SETTINGS_SaveSettings(void)
 		State[i] = 0xFF;
 	}
 
-	EEPROM_WriteBuffer(0x0F40, State);
+	EEPROM_WriteDeferred(0x0F40, State);
 
 	Buf[0] = gBatteryCalibration[4];
 	Buf[1] = gBatteryCalibration[5];
 
-	EEPROM_WriteBuffer(0x1F48, Buf);
+	EEPROM_WriteDeferred(0x1F48, Buf);
 }
 
 void SETTINGS_SaveChannel(uint8_t Channel, uint8_t VFO, const VFO_Info_t *pVFO, uint8_t Mode)
@@ -208,7 +210,7 @@ void SETTINGS_SaveChannel(uint8_t Channel, uint8_t VFO, const VFO_Info_t *pVFO,
 		State32[0] = pVFO->ConfigRX.Frequency;
 		State32[1] = pVFO->FREQUENCY_OF_DEVIATION;
 
-		EEPROM_WriteBuffer(OffsetVFO + 0, State32);
+		EEPROM_WriteDeferred(OffsetVFO + 0, State32);
 
 		State8[0] = pVFO->ConfigRX.Code;
 		State8[1] = pVFO->ConfigTX.Code;
@@ -224,7 +226,11 @@ void SETTINGS_SaveChannel(uint8_t Channel, uint8_t VFO, const VFO_Info_t *pVFO,
 			| (pVFO->MODULATION_MODE << 2)
 			| (pVFO->CompanderMode << 0);
 
-		EEPROM_WriteBuffer(OffsetVFO + 8, State8);
+		EEPROM_WriteDeferred(OffsetVFO + 8, State8);
+
+		if (IS_MR_CHANNEL(Channel)) {
+			RADIO_PackChannel(&gMR_Channels[Channel], State32[0], State32[1], State8);
+		}
 
 		if (Mode > 0) {
 			SETTINGS_UpdateChannel(Channel, pVFO, true);
@@ -238,8 +244,8 @@ void SETTINGS_SaveChannel(uint8_t Channel, uint8_t VFO, const VFO_Info_t *pVFO,
 		if (IS_MR_CHANNEL(Channel)) {
 			// DualTachyon
 			memset(&State32, 0, sizeof(State32));
-			EEPROM_WriteBuffer(OffsetMR + 0x0F50, State32);
-			EEPROM_WriteBuffer(OffsetMR + 0x0F58, State32);
+			EEPROM_WriteDeferred(OffsetMR + 0x0F50, State32);
+			EEPROM_WriteDeferred(OffsetMR + 0x0F58, State32);
 		}
 	}
 }
@@ -268,7 +274,10 @@ void SETTINGS_UpdateChannel(uint8_t Channel, const VFO_Info_t *pVFO, bool bUpdat
 		Attributes = 0xFF;
 	}
 	State[Channel & 7U] = Attributes;
-	EEPROM_WriteBuffer(Offset, State);
+	EEPROM_WriteDeferred(Offset, State);
 	gMR_ChannelAttributes[Channel] = Attributes;
+	if (IS_MR_CHANNEL(Channel)) {
+		RADIO_UpdateChannelBits(Channel);
+	}
 }
 
@@ -94,6 +94,7 @@ typedef struct {
 	uint8_t CROSS_BAND_RX_TX;
 	uint8_t BACKLIGHT;
 	uint8_t SCAN_RESUME_MODE;
+	uint8_t SCAN_ADAPTIVE_DWELL;
 	uint8_t SCAN_LIST_DEFAULT;
 	uint8_t SCAN_LIST_ENABLED[2];
 	uint8_t SCANLIST_PRIORITY_CH1[2];
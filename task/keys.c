@@ -8,6 +8,9 @@
 #include "app/main.h"
 #include "app/menu.h"
 #include "app/scanner.h"
+#if defined(ENABLE_SPECTRUM)
+#include "app/spectrum.h"
+#endif
 #if defined(ENABLE_UART)
 #include "app/uart.h"
 #endif
@@ -32,6 +35,7 @@
 #include "misc.h"
 #include "scheduler.h"
 #include "settings.h"
+#include "timer.h"
 #include "ui/battery.h"
 #include "ui/inputbox.h"
 #include "ui/menu.h"
@@ -44,7 +48,7 @@ static void TASK_ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 	if (gCurrentFunction == FUNCTION_POWER_SAVE) {
 		FUNCTION_Select(FUNCTION_FOREGROUND);
 	}
-	gBatterySaveCountdown = 1000;
+	TIMER_Start(TIMER_POWER_SAVE, 1000);
 	if (gEeprom.AUTO_KEYPAD_LOCK) {
 		gKeyLockCountdown = 30;
 	}
@@ -164,10 +168,19 @@ static void TASK_ProcessKey(KEY_Code_t Key, bool bKeyPressed, bool bKeyHeld)
 			case DISPLAY_SCANNER:
 				SCANNER_ProcessKeys(Key, bKeyPressed, bKeyHeld);
 				break;
+#if defined(ENABLE_SPECTRUM)
+			case DISPLAY_SPECTRUM:
+				SPECTRUM_ProcessKeys(Key, bKeyPressed, bKeyHeld);
+				break;
+#endif
 			default:
 				break;
 			}
-		} else if (gScreenToDisplay != DISPLAY_SCANNER) {
+		} else if (gScreenToDisplay != DISPLAY_SCANNER
+#if defined(ENABLE_SPECTRUM)
+				&& gScreenToDisplay != DISPLAY_SPECTRUM
+#endif
+				) {
 			ACTION_Handle(Key, bKeyPressed, bKeyHeld);
 		}
 	}
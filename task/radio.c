@@ -14,7 +14,11 @@ void TASK_CheckRadioInterrupts(void) {
 	}
 	SCHEDULER_ClearTask(TASK_CHECK_RADIO_INTERRUPTS);
 
-    if ((gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode) && gScreenToDisplay != DISPLAY_SCANNER) {
+    if ((gCurrentFunction != FUNCTION_POWER_SAVE || !gRxIdleMode) && gScreenToDisplay != DISPLAY_SCANNER
+#if defined(ENABLE_SPECTRUM)
+			&& gScreenToDisplay != DISPLAY_SPECTRUM
+#endif
+			) {
 		//APP_CheckRadioInterrupts();
 		while (BK4819_ReadRegister(BK4819_REG_0C) & 1U) {
 			BK4819_WriteRegister(BK4819_REG_02, 0);
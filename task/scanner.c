@@ -3,8 +3,23 @@
 #include "driver/bk4819.h"
 #include "misc.h"
 #include "scheduler.h"
+#include "settings.h"
 #include "ui/ui.h"
 
+#if defined(ENABLE_PERF_STATS)
+static void LogLatency(uint16_t *pHistogram)
+{
+	const uint32_t Now = SCHEDULER_GetTimeUs();
+	uint32_t Bucket = (Now - gScanStartUs) / 100000U;
+
+	if (Bucket >= SCANNER_LATENCY_BUCKETS) {
+		Bucket = SCANNER_LATENCY_BUCKETS - 1;
+	}
+	pHistogram[Bucket]++;
+	gScanStartUs = Now;
+}
+#endif
+
 void TASK_Scanner(void) {
 	if (!SCHEDULER_CheckTask(TASK_SCANNER)) {
 		return;
@@ -15,6 +30,12 @@ void TASK_Scanner(void) {
 		return;
 	}
 
+	// Polled every tick once a freshly started scan has had time to settle
+	if (gScanPollDelay > 0) {
+		gScanPollDelay--;
+		return;
+	}
+
 	uint32_t Result;
 	uint16_t CtcssFreq;
 	BK4819_CssScanResult_t ScanResult;
@@ -29,16 +50,21 @@ void TASK_Scanner(void) {
 			if (Delta < 0) {
 				Delta = -Delta;
 			}
-			if (Delta < 100) {
+			if (Delta < SCANNER_HIT_TOLERANCE) {
 				gScanHitCount++;
 			} else {
 				gScanHitCount = 0;
 			}
 			BK4819_DisableFrequencyScan();
-			if (gScanHitCount < 3) {
+			gScanPollDelay = SCANNER_SETTLE_TICKS;
+			if (gScanHitCount < SCANNER_HIT_COUNT) {
 				BK4819_EnableFrequencyScan();
 			} else {
+#if defined(ENABLE_PERF_STATS)
+				LogLatency(gScanStats.LockLatency);
+#endif
 				BK4819_SetScanFrequency(gScanFrequency);
+				RADIO_InvalidateProfile();
 				gScanCssResultCode = 0xFF;
 				gScanCssResultType = 0xFF;
 				gScanHitCount = 0;
@@ -68,7 +94,7 @@ void TASK_Scanner(void) {
 				if (Code != 0xFF) {
 					if (Code == gScanCssResultCode && gScanCssResultType == CODE_TYPE_CONTINUOUS_TONE) {
 						gScanHitCount++;
-						if (gScanHitCount >= 3) {
+						if (gScanHitCount >= SCANNER_CSS_HIT_COUNT) {
 							gScanCssState = SCAN_CSS_STATE_FOUND;
 							gScanUseCssResult = true;
 						}
@@ -81,8 +107,13 @@ void TASK_Scanner(void) {
 			}
 			if (gScanCssState < SCAN_CSS_STATE_FOUND) {
 				BK4819_SetScanFrequency(gScanFrequency);
+				RADIO_InvalidateProfile();
+				gScanPollDelay = SCANNER_SETTLE_TICKS;
 				break;
 			}
+#if defined(ENABLE_PERF_STATS)
+			LogLatency(gScanStats.CssLatency);
+#endif
 			gRequestDisplayScreen = DISPLAY_SCANNER;
 			break;
 
@@ -0,0 +1,42 @@
+#include "app/spectrum.h"
+#include "driver/bk4819.h"
+#include "frequencies.h"
+#include "misc.h"
+#include "scheduler.h"
+#include "task/spectrum.h"
+#include "ui/ui.h"
+
+// Runs on every pass of the main loop rather than from the 10 ms tick, so
+// the sweep is paced by the RSSI settling time alone.
+void TASK_Spectrum(void)
+{
+	uint32_t Now;
+	uint8_t Rssi;
+
+	if (gScreenToDisplay != DISPLAY_SPECTRUM) {
+		return;
+	}
+
+	Now = SCHEDULER_GetTimeUs();
+	if (Now - gSpectrumTunedUs < SPECTRUM_DWELL_US) {
+		return;
+	}
+
+	Rssi = BK4819_GetRSSI() >> 1;
+	gSpectrumRssi[gSpectrumIndex] = Rssi;
+	if (gSpectrumPeak[gSpectrumIndex] < Rssi) {
+		gSpectrumPeak[gSpectrumIndex] = Rssi;
+	}
+
+	if (++gSpectrumIndex >= gSpectrumPoints) {
+		gSpectrumRate = (gSpectrumPoints * 1000000U) / (Now - gSpectrumSweepUs);
+		gSpectrumSweeps++;
+		gSpectrumSweepUs = Now;
+		gSpectrumIndex = 0;
+		gUpdateDisplay = true;
+	}
+
+	SPECTRUM_Tune(gSpectrumStart + (gSpectrumIndex * StepFrequencyTable[gSpectrumStepSetting]));
+	gSpectrumTunedUs = SCHEDULER_GetTimeUs();
+}
+
@@ -0,0 +1,7 @@
+#ifndef TASK_SPECTRUM_H
+#define TASK_SPECTRUM_H
+
+void TASK_Spectrum(void);
+
+#endif
+
@@ -0,0 +1,184 @@
+// Checks that the BK4819_Sequence_t tables put the same frames on the bus,
+// in the same order, as the open-coded calls they replaced. Each pair runs
+// from the same chip registers and the same driver shadow, once with
+// nothing cached and once with every register cached.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "driver/bk4819.h"
+#include "tests/bk4819sim.h"
+
+static SIM_BusFrame_t Expected[SIM_BUS_LOG_SIZE];
+static uint32_t ExpectedLength;
+static uint16_t ExpectedRegisters[128];
+static int Failures;
+static uint32_t Frames;
+
+static void OldInitAGC(void)
+{
+	BK4819_WriteRegister(BK4819_REG_7E, // 1o11
+		(0u << 15) |                    // 0 AGC fix mode
+		(3u << 12) |                    // 3 AGC fix index
+		(5u <<  3) |                    // 5 DC filter bandwidth for Tx
+		(6u <<  0));                    // 6 DC filter bandwidth for Rx
+
+	// AGC fix indexes
+	BK4819_WriteRegister(BK4819_REG_13, 0x03BE); // 3
+	BK4819_WriteRegister(BK4819_REG_12, 0x037B); // 2
+	BK4819_WriteRegister(BK4819_REG_11, 0x027B); // 1
+	BK4819_WriteRegister(BK4819_REG_10, 0x007A); // 0
+	BK4819_WriteRegister(BK4819_REG_14, 0x0019); // -1
+
+	BK4819_WriteRegister(BK4819_REG_7B, 0x8420);
+}
+
+// The three pins are idle high already, so setting them again is no edge
+static void OldInit(void)
+{
+	BK4819_WriteRegister(BK4819_REG_00, 0x8000);
+	BK4819_WriteRegister(BK4819_REG_00, 0);
+	BK4819_WriteRegister(BK4819_REG_09, 0x006F);
+	BK4819_WriteRegister(BK4819_REG_09, 0x106B);
+	BK4819_WriteRegister(BK4819_REG_09, 0x2067);
+	BK4819_WriteRegister(BK4819_REG_09, 0x3062);
+	BK4819_WriteRegister(BK4819_REG_09, 0x4050);
+	BK4819_WriteRegister(BK4819_REG_09, 0x5047);
+	BK4819_WriteRegister(BK4819_REG_09, 0x603A);
+	BK4819_WriteRegister(BK4819_REG_09, 0x702C);
+	BK4819_WriteRegister(BK4819_REG_09, 0x8041);
+	BK4819_WriteRegister(BK4819_REG_09, 0x9037);
+	BK4819_WriteRegister(BK4819_REG_09, 0xA025);
+	BK4819_WriteRegister(BK4819_REG_09, 0xB017);
+	BK4819_WriteRegister(BK4819_REG_09, 0xC0E4);
+	BK4819_WriteRegister(BK4819_REG_09, 0xD0CB);
+	BK4819_WriteRegister(BK4819_REG_09, 0xE0B5);
+	BK4819_WriteRegister(BK4819_REG_09, 0xF09F);
+	BK4819_WriteRegister(BK4819_REG_1F, 0x5454);
+	BK4819_WriteRegister(BK4819_REG_3E, 0xA037);
+	OldInitAGC();
+
+	BK4819_WriteRegister(BK4819_REG_33, 0x9000);
+	BK4819_WriteRegister(BK4819_REG_3F, 0);
+}
+
+static void OldTxOn_Beep(void)
+{
+	BK4819_WriteRegister(BK4819_REG_37, 0x1D0F);
+	BK4819_WriteRegister(BK4819_REG_52, 0x028F);
+	BK4819_WriteRegister(BK4819_REG_30, 0);
+	BK4819_WriteRegister(BK4819_REG_30, 0xC1FE);
+}
+
+static void OldDigitalTx(BK4819_FilterBandwidth_t Bandwidth)
+{
+	BK4819_WriteRegister(BK4819_REG_47, (2u << 12) | (BK4819_AF_MUTE << 8) | (1u << 6) | 1);
+	BK4819_WriteRegister(BK4819_REG_7E, (BK4819_ReadRegister(BK4819_REG_7E) & 0xFFC7) | 0x8000);
+	BK4819_WriteRegister(BK4819_REG_2B, (BK4819_ReadRegister(BK4819_REG_2B) & 0xFFF8) | 0x7);
+	BK4819_WriteRegister(BK4819_REG_4B, (1 << 15));
+	BK4819_WriteRegister(BK4819_REG_19, 0x1041);
+	BK4819_WriteRegister(BK4819_REG_7D, 0xE940);
+	switch (Bandwidth) {
+	default:
+	case BK4819_FILTER_BW_NARROW:
+	case BK4819_FILTER_BW_DIGITAL_NARROW:
+		BK4819_WriteRegister(BK4819_REG_40, 0x14D6);
+		break;
+	case BK4819_FILTER_BW_WIDE:
+	case BK4819_FILTER_BW_DIGITAL_WIDE:
+		BK4819_WriteRegister(BK4819_REG_40, 0x1383);
+		break;
+	}
+	BK4819_ExitTxMute();
+	OldTxOn_Beep();
+}
+
+static void OldDigitalTxNarrow(void)
+{
+	OldDigitalTx(BK4819_FILTER_BW_NARROW);
+}
+
+static void NewDigitalTxNarrow(void)
+{
+	BK4819_PrepareDigitalTransmit(BK4819_FILTER_BW_NARROW);
+}
+
+static void OldDigitalTxWide(void)
+{
+	OldDigitalTx(BK4819_FILTER_BW_WIDE);
+}
+
+static void NewDigitalTxWide(void)
+{
+	BK4819_PrepareDigitalTransmit(BK4819_FILTER_BW_WIDE);
+}
+
+// Random chip registers, and in the warm case the same values written
+// through the driver so that it has all of them cached
+static void Prepare(uint32_t Seed, bool bWarm)
+{
+	uint8_t i;
+
+	srand(Seed);
+	SIM_BusForgetShadow();
+	for (i = 0; i < 128; i++) {
+		gSimRegisters[i] = rand();
+		if (bWarm && i != BK4819_REG_00) {
+			BK4819_WriteRegister(i, gSimRegisters[i]);
+		}
+	}
+	SIM_BusClearLog();
+	gSimBusErrors = 0;
+}
+
+static void Compare(const char *pName, void (*pOld)(void), void (*pNew)(void))
+{
+	uint32_t Seed;
+
+	for (Seed = 1; Seed <= 20; Seed++) {
+		const bool bWarm = Seed & 1;
+
+		Prepare(Seed, bWarm);
+		pOld();
+		memcpy(Expected, gSimBusLog, gSimBusLogLength * sizeof(Expected[0]));
+		ExpectedLength = gSimBusLogLength;
+		memcpy(ExpectedRegisters, gSimRegisters, sizeof(ExpectedRegisters));
+
+		Prepare(Seed, bWarm);
+		pNew();
+		Frames += gSimBusLogLength;
+
+		if (gSimBusErrors || gSimBusLogLength != ExpectedLength || memcmp(Expected, gSimBusLog, ExpectedLength * sizeof(Expected[0])) || memcmp(ExpectedRegisters, gSimRegisters, sizeof(ExpectedRegisters))) {
+			printf("  %s, %s shadow, seed %u differs\n  open-coded:\n", pName, bWarm ? "warm" : "cold", Seed);
+			SIM_BusPrintLog(Expected, ExpectedLength);
+			printf("  table:\n");
+			SIM_BusPrintLog(gSimBusLog, gSimBusLogLength);
+			Failures++;
+			return;
+		}
+		if (Seed <= 2) {
+			printf("%-22s %s shadow %2u frames\n", pName, bWarm ? "warm" : "cold", gSimBusLogLength);
+		}
+	}
+}
+
+int main(void)
+{
+	// Leaves the three bus pins idle high, and checks the decoder
+	BK4819_Init();
+	gSimRegisters[BK4819_REG_0C] = 0xA55A;
+	if (gSimBusErrors || gSimBusLog[0].Register != BK4819_REG_00 || gSimBusLog[0].Value != 0x8000 || gSimRegisters[BK4819_REG_09] != 0xF09F || BK4819_ReadRegister(BK4819_REG_0C) != 0xA55A) {
+		printf("  the bus decoder is broken\n");
+		return EXIT_FAILURE;
+	}
+
+	Compare("BK4819_Init", OldInit, BK4819_Init);
+	Compare("BK4819_InitAGC", OldInitAGC, BK4819_InitAGC);
+	Compare("BK4819_TxOn_Beep", OldTxOn_Beep, BK4819_TxOn_Beep);
+	Compare("digital TX, narrow", OldDigitalTxNarrow, NewDigitalTxNarrow);
+	Compare("digital TX, wide", OldDigitalTxWide, NewDigitalTxWide);
+	printf("%u frames compared, %d sequences differ\n", Frames, Failures);
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
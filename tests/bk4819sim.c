@@ -0,0 +1,200 @@
+// Builds driver/bk4819.c against a fake GPIOC and decodes its pin changes.
+// The driver selects the chip with SCN low and clocks 8 address bits, the
+// top one set for a read, then 16 data bits on rising edges of SCL. For a
+// read the chip drives SDA and the driver samples it before each rise.
+// The stock bus changes pins through GPIO_SetBit() and GPIO_ClearBit(). The
+// fast bus stores GPIOC->DATA directly and holds each level with NOPs, so
+// with ENABLE_FAST_BK4819_BUS the pins are sampled at every __NOP().
+
+#include <stdio.h>
+#include <string.h>
+#include "bsp/dp32g030/gpio.h"
+#include "bsp/dp32g030/portcon.h"
+
+static GPIO_Bank_t FakeGpioC;
+static uint32_t FakePortcIe;
+
+#undef GPIOC
+#undef PORTCON_PORTC_IE
+#define GPIOC ((volatile GPIO_Bank_t *)&FakeGpioC)
+#define PORTCON_PORTC_IE FakePortcIe
+
+#include "driver/bk4819.c"
+#include "tests/bk4819sim.h"
+
+uint16_t gSimRegisters[128];
+SIM_BusFrame_t gSimBusLog[SIM_BUS_LOG_SIZE];
+uint32_t gSimBusLogLength;
+uint32_t gSimBusErrors;
+uint32_t gSimShadowErrors;
+bool gSimBusUncached;
+uint32_t gSimBusHolds;
+uint32_t gSimBusNops;
+
+static bool bSelected;
+static uint8_t Bits;
+static uint8_t Address;
+static uint16_t Value;
+static uint32_t Pins;
+
+static void Log(uint8_t Register, uint16_t Data)
+{
+	if (gSimBusLogLength == SIM_BUS_LOG_SIZE) {
+		gSimBusErrors++;
+		return;
+	}
+	gSimBusLog[gSimBusLogLength].Register = Register;
+	gSimBusLog[gSimBusLogLength].Value = Data;
+	gSimBusLogLength++;
+}
+
+static bool IsReading(void)
+{
+	return bSelected && Bits >= 8 && Bits < 24 && (Address & SIM_BUS_READ);
+}
+
+static void EndFrame(void)
+{
+	uint8_t i;
+
+	if ((Address & SIM_BUS_READ) == 0) {
+		gSimRegisters[Address] = Value;
+		if (Address == BK4819_REG_02) {
+			gSimRegisters[BK4819_REG_0C] &= ~1U;
+		}
+	}
+	Log(Address, Value);
+
+	for (i = 0; i < 128; i++) {
+		if (SIM_BusIsCached(i) && gBK4819_Shadow[i] != gSimRegisters[i]) {
+			gSimShadowErrors++;
+		}
+	}
+	if (gSimBusUncached) {
+		SIM_BusForgetShadow();
+	}
+}
+
+static void Edge(uint32_t Old, uint32_t New)
+{
+	const uint32_t Rise = ~Old & New;
+	const uint32_t Fall = Old & ~New;
+
+	Pins = New;
+	if (Rise & (1U << GPIOC_PIN_BK4819_SCN)) {
+		if (bSelected && Bits == 24) {
+			EndFrame();
+		} else if (bSelected && Bits) {
+			gSimBusErrors++;
+		}
+		bSelected = false;
+	}
+	if (Fall & (1U << GPIOC_PIN_BK4819_SCN)) {
+		bSelected = true;
+		Bits = 0;
+		Address = 0;
+		Value = 0;
+	}
+	if (bSelected && (Rise & (1U << GPIOC_PIN_BK4819_SCL)) && Bits < 24) {
+		const uint8_t Sda = (New >> GPIOC_PIN_BK4819_SDA) & 1U;
+
+		if (Bits < 8) {
+			Address = (Address << 1) | Sda;
+			if (Bits == 7 && (Address & SIM_BUS_READ)) {
+				Value = gSimRegisters[Address & 0x7F];
+			}
+		} else if ((Address & SIM_BUS_READ) == 0) {
+			Value = (Value << 1) | Sda;
+		}
+		Bits++;
+	}
+}
+
+void GPIO_SetBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	if (pReg == &GPIOC->DATA) {
+		const uint32_t Old = FakeGpioC.DATA;
+
+		FakeGpioC.DATA |= 1U << Bit;
+		Edge(Old, FakeGpioC.DATA);
+		gSimBusHolds++;
+	}
+}
+
+void GPIO_ClearBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	if (pReg == &GPIOC->DATA) {
+		const uint32_t Old = FakeGpioC.DATA;
+
+		FakeGpioC.DATA &= ~(1U << Bit);
+		Edge(Old, FakeGpioC.DATA);
+		gSimBusHolds++;
+	}
+}
+
+uint8_t GPIO_CheckBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	if (pReg != &GPIOC->DATA) {
+		return 0;
+	}
+	if (Bit == GPIOC_PIN_BK4819_SDA && IsReading()) {
+		if ((FakeGpioC.DIR & GPIO_DIR_2_MASK) != GPIO_DIR_2_BITS_INPUT || (FakePortcIe & PORTCON_PORTC_IE_C2_MASK) != PORTCON_PORTC_IE_C2_BITS_ENABLE) {
+			gSimBusErrors++;
+		}
+		return (Value >> (15 - (Bits - 8))) & 1U;
+	}
+
+	return (FakeGpioC.DATA >> Bit) & 1U;
+}
+
+// BusDelay() is six of these in a row, the first one sees the new level
+void __NOP(void)
+{
+	if (FakeGpioC.DATA != Pins) {
+		Edge(Pins, FakeGpioC.DATA);
+	}
+	// The chip drives SDA once SCL falls after the last address bit
+	if (IsReading() && (Pins & (1U << GPIOC_PIN_BK4819_SCL)) == 0) {
+		if ((FakeGpioC.DIR & GPIO_DIR_2_MASK) != GPIO_DIR_2_BITS_INPUT || (FakePortcIe & PORTCON_PORTC_IE_C2_MASK) != PORTCON_PORTC_IE_C2_BITS_ENABLE) {
+			gSimBusErrors++;
+		}
+		FakeGpioC.DATA &= ~(1U << GPIOC_PIN_BK4819_SDA);
+		FakeGpioC.DATA |= ((Value >> (15 - (Bits - 8))) & 1U) << GPIOC_PIN_BK4819_SDA;
+		Pins = FakeGpioC.DATA;
+	}
+	gSimBusNops++;
+}
+
+void SYSTEM_DelayMs(uint32_t Delay)
+{
+	Log(SIM_BUS_DELAY, Delay);
+}
+
+void SIM_BusClearLog(void)
+{
+	gSimBusLogLength = 0;
+}
+
+void SIM_BusForgetShadow(void)
+{
+	memset(gBK4819_ShadowValid, 0, sizeof(gBK4819_ShadowValid));
+}
+
+bool SIM_BusIsCached(uint8_t Register)
+{
+	return (gBK4819_ShadowValid[Register >> 5] >> (Register & 31)) & 1U;
+}
+
+void SIM_BusPrintLog(const SIM_BusFrame_t *pLog, uint32_t Length)
+{
+	uint32_t i;
+
+	for (i = 0; i < Length; i++) {
+		if (pLog[i].Register == SIM_BUS_DELAY) {
+			printf("    delay %u ms\n", pLog[i].Value);
+		} else {
+			printf("    %s %02X %04X\n", (pLog[i].Register & SIM_BUS_READ) ? "read " : "write", pLog[i].Register & 0x7F, pLog[i].Value);
+		}
+	}
+}
+
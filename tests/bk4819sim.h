@@ -0,0 +1,47 @@
+// Host model of the BK4819 on its 3-wire bus. tests/bk4819sim.c builds
+// driver/bk4819.c against a fake GPIOC and decodes the pin changes it makes
+// back into register reads and writes. Reads are answered from
+// gSimRegisters and writes land there. A write to REG_02 clears the
+// interrupt request bit of REG_0C, everything else is plain storage.
+
+#ifndef TESTS_BK4819SIM_H
+#define TESTS_BK4819SIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SIM_BUS_LOG_SIZE 4096U
+// Register of a log entry for a read, and the entry for a SYSTEM_DelayMs()
+#define SIM_BUS_READ     0x80U
+#define SIM_BUS_DELAY    0xFFU
+
+typedef struct {
+	uint8_t Register;
+	uint16_t Value;
+} SIM_BusFrame_t;
+
+extern uint16_t gSimRegisters[128];
+extern SIM_BusFrame_t gSimBusLog[SIM_BUS_LOG_SIZE];
+extern uint32_t gSimBusLogLength;
+// Frames without 24 clocks, SDA read while driven and log overflows
+extern uint32_t gSimBusErrors;
+// Frames after which a register the driver had cached differed from the chip
+extern uint32_t gSimShadowErrors;
+// Forgets the driver's shadow after every frame, so that each read and each
+// write reaches the chip as it did before the shadow existed
+extern bool gSimBusUncached;
+// GPIO_SetBit() and GPIO_ClearBit() calls on GPIOC, each waits 2 us
+extern uint32_t gSimBusHolds;
+// NOPs of the fast bus, six to each wait
+extern uint32_t gSimBusNops;
+
+void SIM_BusClearLog(void);
+// Forgets every register the driver has cached, as after a power up
+void SIM_BusForgetShadow(void);
+// Whether the driver answers reads of the register from its shadow
+bool SIM_BusIsCached(uint8_t Register);
+// Prints the log, one frame per line
+void SIM_BusPrintLog(const SIM_BusFrame_t *pLog, uint32_t Length);
+
+#endif
+
@@ -0,0 +1,125 @@
+// Writes the simulated EEPROM with the bulk write command (0x0551) the way
+// eeprom-write.py does, in a plain and in an obfuscated session, and checks
+// that refused blocks are left alone.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "misc.h"
+#include "tests/uartsim.h"
+
+static int Failures;
+
+static void Check(bool bOk, const char *pWhat)
+{
+	if (!bOk) {
+		printf("  FAILED: %s\n", pWhat);
+		Failures++;
+	}
+}
+
+// Returns the size the radio acknowledged, or -1 without an acknowledgement
+static int WriteBlock(uint16_t Offset, const uint8_t *pData, uint8_t Size, bool bAllowPassword)
+{
+	uint8_t Command[12 + 128] = { 0x51, 0x05 };
+	const uint32_t Timestamp = SIM_TIMESTAMP;
+	const uint8_t Length = Size > 128 ? 128 : Size;
+	uint8_t Reply[256];
+	uint16_t AckOffset;
+
+	Command[2] = 8 + Length;
+	memcpy(Command + 4, &Offset, 2);
+	Command[6] = Size;
+	Command[7] = bAllowPassword;
+	memcpy(Command + 8, &Timestamp, 4);
+	memcpy(Command + 12, pData, Length);
+	SIM_Send(Command, 12 + Length);
+
+	while (SIM_Receive(Reply, 500000.0) >= 0) {
+		memcpy(&AckOffset, Reply + 4, 2);
+		if (Reply[0] == 0x52 && Reply[1] == 0x05 && AckOffset == Offset) {
+			return Reply[6];
+		}
+	}
+
+	return -1;
+}
+
+static void Upload(const char *pName, bool bObfuscated)
+{
+	static uint8_t Image[EEPROM_SIZE];
+	uint32_t i;
+	double Start;
+	double Elapsed;
+
+	for (i = 0; i < EEPROM_SIZE; i++) {
+		Image[i] = rand();
+	}
+
+	Check(SIM_Hello(bObfuscated), "no reply to 0x0514");
+	gSimPageWrites = 0;
+	Start = gSimHostUs;
+	for (i = 0; i < EEPROM_SIZE; i += 128) {
+		Check(WriteBlock(i, Image + i, 128, true) == 128, "a block was not acknowledged");
+	}
+	// The last block is still being programmed
+	Check(SIM_Hello(bObfuscated), "no reply to 0x0514");
+	Elapsed = gSimHostUs - Start;
+
+	printf("%-28s %.2f s %5.0f B/s, %u page writes\n", pName, Elapsed / 1e6, EEPROM_SIZE * 1e6 / Elapsed, gSimPageWrites);
+	Check(memcmp(Image, gSimEeprom, EEPROM_SIZE) == 0, "the image differs");
+}
+
+int main(void)
+{
+	static uint8_t Before[EEPROM_SIZE];
+	uint8_t Block[128];
+	uint32_t i;
+
+	srand(1);
+	SIM_Init();
+
+	Upload("plain, 4 ms turnaround", false);
+	Upload("obfuscated, 4 ms turnaround", true);
+
+	// 13 bytes lands on the 0x0D of the key in an obfuscated reply
+	printf("odd sizes\n");
+	memset(Block, 0xA5, sizeof(Block));
+	Check(WriteBlock(0x0100, Block, 13, true) == 13, "the 13 byte block was not acknowledged");
+	Check(WriteBlock(0x0200, Block, 1, true) == 1, "the 1 byte block was not acknowledged");
+	Check(SIM_Hello(true), "no reply to 0x0514");
+	Check(memcmp(gSimEeprom + 0x0100, Block, 13) == 0, "the 13 byte block was not written");
+	Check(gSimEeprom[0x0200] == 0xA5, "the 1 byte block was not written");
+
+	printf("refused blocks\n");
+	memcpy(Before, gSimEeprom, EEPROM_SIZE);
+	memset(Block, 0x5A, sizeof(Block));
+	Check(WriteBlock(EEPROM_SIZE - 64, Block, 128, true) == 0, "a block past the end was acknowledged");
+	Check(WriteBlock(0x0000, Block, 129, true) == 0, "a block over 128 bytes was acknowledged");
+	bHasCustomAesKey = true;
+	gIsLocked = true;
+	Check(WriteBlock(0x0000, Block, 128, true) == 0, "a block was acknowledged while locked");
+	bHasCustomAesKey = false;
+	gIsLocked = false;
+	Check(SIM_Hello(true), "no reply to 0x0514");
+	Check(memcmp(Before, gSimEeprom, EEPROM_SIZE) == 0, "a refused block was written");
+
+	printf("lock screen password\n");
+	bIsInLockScreen = true;
+	Check(WriteBlock(0x0E80, Block, 128, false) == 128, "the block was not acknowledged");
+	Check(SIM_Hello(true), "no reply to 0x0514");
+	for (i = 0x0E80; i < 0x0F00; i++) {
+		if (i >= 0x0E98 && i < 0x0EA0) {
+			Check(gSimEeprom[i] == Before[i], "the password was overwritten");
+		} else {
+			Check(gSimEeprom[i] == 0x5A, "the block was not written around the password");
+		}
+	}
+	bIsInLockScreen = false;
+
+	Check(gSimOutOfBounds == 0, "the EEPROM was written out of bounds");
+	Check(gSimMaskedWrites == 0, "the EEPROM was written with interrupts masked");
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
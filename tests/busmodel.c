@@ -0,0 +1,104 @@
+// Runs random register reads and writes through the BK4819 bus the driver
+// was built with, the stock one or with ENABLE_FAST_BK4819_BUS the fast
+// one, and checks every frame against the bus model in tests/bk4819sim.c.
+// Then counts the waits in each frame, which with the length of a wait in
+// each variant gives a lower bound on the time of a frame. The stock bus
+// waits at least 2 us after every GPIO_SetBit() and GPIO_ClearBit(). The
+// fast bus waits six NOPs, at least six cycles of the 48 MHz core, and
+// the loop around them costs more by an amount only the target can show.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "driver/bk4819.h"
+#include "tests/bk4819sim.h"
+
+#define OPERATIONS 20000U
+#define CORE_MHZ 48.0
+
+static int Failures;
+
+static void Check(bool bOk, const char *pWhat)
+{
+	if (!bOk) {
+		printf("  FAILED: %s\n", pWhat);
+		Failures++;
+	}
+}
+
+// Waits and NOPs of one frame, the same for every frame of a kind
+static void Count(uint32_t *pHolds, uint32_t *pNops, uint32_t Holds, uint32_t Nops, const char *pWhat)
+{
+	if (*pHolds == 0 && *pNops == 0) {
+		*pHolds = Holds;
+		*pNops = Nops;
+	}
+	Check(*pHolds == Holds && *pNops == Nops, pWhat);
+}
+
+static void Model(const char *pName, uint32_t Holds, uint32_t Nops)
+{
+#if defined(ENABLE_FAST_BK4819_BUS)
+	const uint32_t Waits = Nops / 6;
+	const double Us = Nops / CORE_MHZ;
+
+	(void)Holds;
+	printf("  %s: %2u waits of 6 NOPs, at least %6.2f us, at most %4.0f per ms\n", pName, Waits, Us, 1000.0 / Us);
+#else
+	const double Us = Holds * 2.0;
+
+	(void)Nops;
+	printf("  %s: %2u waits of 2 us, at least %6.2f us, at most %4.0f per ms\n", pName, Holds, Us, 1000.0 / Us);
+#endif
+}
+
+int main(void)
+{
+	uint32_t ReadHolds = 0;
+	uint32_t ReadNops = 0;
+	uint32_t WriteHolds = 0;
+	uint32_t WriteNops = 0;
+	uint32_t i;
+
+#if defined(ENABLE_FAST_BK4819_BUS)
+	printf("fast bus\n");
+#else
+	printf("stock bus\n");
+#endif
+
+	// Every access reaches the bus, nothing is answered from the shadow
+	gSimBusUncached = true;
+	BK4819_Init();
+	Check(gSimBusErrors == 0 && gSimRegisters[BK4819_REG_09] == 0xF09F, "BK4819_Init() did not reach the chip");
+
+	srand(1);
+	for (i = 0; i < OPERATIONS; i++) {
+		// REG_00 resets and REG_02 clears REG_0C, leave them out
+		const uint8_t Register = 3 + (rand() % 125);
+		const uint16_t Data = rand();
+
+		SIM_BusClearLog();
+		gSimBusHolds = 0;
+		gSimBusNops = 0;
+		if (rand() % 2) {
+			BK4819_WriteRegister(Register, Data);
+			Check(gSimBusLogLength == 1 && gSimBusLog[0].Register == Register && gSimBusLog[0].Value == Data, "a write was not one frame with the register and value");
+			Check(gSimRegisters[Register] == Data, "a write did not reach the chip");
+			Count(&WriteHolds, &WriteNops, gSimBusHolds, gSimBusNops, "write frames differ in length");
+		} else {
+			gSimRegisters[Register] = Data;
+			Check(BK4819_ReadRegister(Register) == Data, "a read did not return the chip value");
+			Check(gSimBusLogLength == 1 && gSimBusLog[0].Register == (Register | SIM_BUS_READ), "a read was not one frame with the register");
+			Count(&ReadHolds, &ReadNops, gSimBusHolds, gSimBusNops, "read frames differ in length");
+		}
+		if (Failures || gSimBusErrors) {
+			printf("  operation %u on register %02X failed, %u bad frames\n", i, Register, gSimBusErrors);
+			return EXIT_FAILURE;
+		}
+	}
+
+	printf("  %u random frames decoded as sent\n", OPERATIONS);
+	Model("write", WriteHolds, WriteNops);
+	Model("read ", ReadHolds, ReadNops);
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,208 @@
+// Checks the packed MR channel index against the decode of the 16 byte
+// EEPROM record it replaced, and counts what an MR hop through
+// RADIO_ConfigureChannel() costs on the I2C bus now and with the reads the
+// hop made before the index. radio.c is linked with unused sections
+// dropped, EEPROM_ReadBuffer() is a stub that counts bus bytes.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "dcs.h"
+#include "frequencies.h"
+#include "misc.h"
+#include "radio.h"
+#include "settings.h"
+
+#define RECORDS 1000000U
+// Bit-banged I2C at roughly 200 kHz, as in tests/uartsim.c
+#define I2C_BYTE_US 45.0
+
+uint8_t gMR_ChannelAttributes[FREQ_CHANNEL_LAST + 1];
+MR_Channel_t gMR_Channels[MR_CHANNEL_LAST + 1];
+EEPROM_Config_t gEeprom;
+EEPROM_VFO_t gVFO;
+
+static uint8_t Eeprom[0x2000];
+static uint32_t Reads;
+static uint32_t BusBytes;
+static int Failures;
+
+static void Check(bool bOk, const char *pWhat)
+{
+	if (!bOk) {
+		printf("  FAILED: %s\n", pWhat);
+		Failures++;
+	}
+}
+
+// Device address, two address bytes and the read address, then the data
+void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
+{
+	memcpy(pBuffer, Eeprom + Address, Size);
+	Reads++;
+	BusBytes += 4 + Size;
+}
+
+void SETTINGS_SaveChannel(uint8_t Channel, uint8_t VFO, const VFO_Info_t *pVFO, uint8_t Mode)
+{
+	(void)Channel;
+	(void)VFO;
+	(void)pVFO;
+	(void)Mode;
+}
+
+// The decode of RADIO_ConfigureChannel() before the index
+static void OldDecode(VFO_Info_t *pInfo, uint32_t Frequency, uint32_t Offset, const uint8_t *Data)
+{
+	pInfo->ConfigRX.Frequency = Frequency;
+	pInfo->FREQUENCY_OF_DEVIATION = Offset;
+
+	pInfo->ConfigRX.Code = Data[0];
+	pInfo->ConfigTX.Code = Data[1];
+
+	pInfo->ConfigRX.CodeType = (Data[2] & 0x0F);
+	pInfo->ConfigTX.CodeType = (Data[2] >> 4) & 0x0F;
+
+	pInfo->FREQUENCY_DEVIATION_SETTING = (Data[3] & 3);
+	pInfo->FrequencyReverse = (Data[3] >> 4) & 1;
+
+	pInfo->CHANNEL_BANDWIDTH = (Data[4] & 3);
+	pInfo->OUTPUT_POWER = (Data[4] >> 2) & 3;
+	pInfo->BUSY_CHANNEL_LOCK = (Data[4] >> 4) & 1;
+
+	pInfo->DTMF_DECODING_ENABLE = (Data[5] & 1);
+	pInfo->DTMF_PTT_ID_TX_MODE = (Data[5] >> 1) & 3;
+
+	pInfo->STEP_SETTING = Data[6];
+	pInfo->StepFrequency = StepFrequencyTable[Data[6]];
+
+	pInfo->CompanderMode = (Data[7] & 3);
+	pInfo->MODULATION_MODE = (Data[7] >> 2) & 3;
+	pInfo->MDC1200_MODE = (Data[7] >> 4) & 3;
+}
+
+// A record as SETTINGS_SaveChannel() or a programming tool writes it, with
+// the unused bits of the settings block set at random
+static void RandomRecord(uint32_t *pFrequency, uint32_t *pOffset, uint8_t *pData)
+{
+	uint8_t i;
+
+	*pFrequency = ((uint32_t)rand() << 8 ^ rand()) % 130000001U;
+	*pOffset = ((uint32_t)rand() << 8 ^ rand()) % 130000001U;
+	for (i = 0; i < 8; i++) {
+		pData[i] = rand();
+	}
+	pData[2] = (rand() % 4) | ((rand() % 4) << 4);
+	pData[6] = rand() % 7;
+}
+
+static bool SameFields(const VFO_Info_t *pA, const VFO_Info_t *pB)
+{
+	return pA->ConfigRX.Frequency == pB->ConfigRX.Frequency
+		&& pA->FREQUENCY_OF_DEVIATION == pB->FREQUENCY_OF_DEVIATION
+		&& pA->ConfigRX.Code == pB->ConfigRX.Code
+		&& pA->ConfigTX.Code == pB->ConfigTX.Code
+		&& pA->ConfigRX.CodeType == pB->ConfigRX.CodeType
+		&& pA->ConfigTX.CodeType == pB->ConfigTX.CodeType
+		&& pA->FREQUENCY_DEVIATION_SETTING == pB->FREQUENCY_DEVIATION_SETTING
+		&& pA->FrequencyReverse == pB->FrequencyReverse
+		&& pA->CHANNEL_BANDWIDTH == pB->CHANNEL_BANDWIDTH
+		&& pA->OUTPUT_POWER == pB->OUTPUT_POWER
+		&& pA->BUSY_CHANNEL_LOCK == pB->BUSY_CHANNEL_LOCK
+		&& pA->DTMF_DECODING_ENABLE == pB->DTMF_DECODING_ENABLE
+		&& pA->DTMF_PTT_ID_TX_MODE == pB->DTMF_PTT_ID_TX_MODE
+		&& pA->STEP_SETTING == pB->STEP_SETTING
+		&& pA->StepFrequency == pB->StepFrequency
+		&& pA->CompanderMode == pB->CompanderMode
+		&& pA->MODULATION_MODE == pB->MODULATION_MODE
+		&& pA->MDC1200_MODE == pB->MDC1200_MODE;
+}
+
+static void Decode(void)
+{
+	uint32_t Frequency;
+	uint32_t Offset;
+	uint8_t Data[8];
+	uint32_t i;
+
+	printf("packed records\n");
+	srand(1);
+	for (i = 0; i < RECORDS; i++) {
+		VFO_Info_t Old;
+		VFO_Info_t New;
+		MR_Channel_t Channel;
+
+		memset(&Old, 0, sizeof(Old));
+		memset(&New, 0, sizeof(New));
+		RandomRecord(&Frequency, &Offset, Data);
+		OldDecode(&Old, Frequency, Offset, Data);
+		RADIO_PackChannel(&Channel, Frequency, Offset, Data);
+		RADIO_UnpackChannel(&New, &Channel);
+		if (!SameFields(&Old, &New)) {
+			printf("  %u %u %02X %02X %02X %02X %02X %02X %02X %02X decodes differently\n", Frequency, Offset, Data[0], Data[1], Data[2], Data[3], Data[4], Data[5], Data[6], Data[7]);
+			Failures++;
+			return;
+		}
+	}
+	printf("  %u records decode as before\n", RECORDS);
+
+	// Values no tool writes, which the old decode took as they were
+	{
+		VFO_Info_t New;
+		MR_Channel_t Channel;
+
+		memset(Data, 0xFF, sizeof(Data));
+		RADIO_PackChannel(&Channel, 0xFFFFFFFF, 0xFFFFFFFF, Data);
+		RADIO_UnpackChannel(&New, &Channel);
+		Check(New.ConfigRX.Frequency == MR_CHANNEL_FREQUENCY_MASK && New.ConfigRX.Frequency > UpperLimitFrequencyBandTable[BAND7_470MHz], "a frequency past 27 bits is not clamped above every band");
+		Check(New.FREQUENCY_OF_DEVIATION == MR_CHANNEL_FREQUENCY_MASK, "an offset past 27 bits is not clamped");
+		Check(New.ConfigRX.CodeType == CODE_TYPE_OFF && New.ConfigTX.CodeType == CODE_TYPE_OFF, "an unknown code type is not turned off");
+		Check(New.STEP_SETTING == STEP_12_5kHz && New.StepFrequency == 1250, "a step past the table is not 12.5 kHz");
+	}
+}
+
+static void Hops(void)
+{
+	uint32_t OldBytes;
+	uint32_t OldReads;
+	uint8_t Channel;
+
+	printf("MR hops\n");
+	srand(2);
+	for (Channel = 0; Channel <= MR_CHANNEL_LAST; Channel++) {
+		uint32_t Record[4];
+
+		RandomRecord(&Record[0], &Record[1], (uint8_t *)&Record[2]);
+		// Inside the 144 MHz band so nothing is clamped
+		Record[0] = 14400000 + (Channel * 2500);
+		memcpy(Eeprom + (Channel * 16), Record, sizeof(Record));
+		RADIO_PackChannel(&gMR_Channels[Channel], Record[0], Record[1], (const uint8_t *)&Record[2]);
+		gMR_ChannelAttributes[Channel] = BAND3_136MHz;
+	}
+	RADIO_InitChannelBits();
+	gEeprom.SQUELCH_LEVEL = 4;
+
+	Reads = 0;
+	BusBytes = 0;
+	for (Channel = 0; Channel <= MR_CHANNEL_LAST; Channel++) {
+		gEeprom.ScreenChannel[0] = Channel;
+		RADIO_ConfigureChannel(0, VFO_CONFIGURE_RELOAD);
+		Check(gVFO.Info[0].CHANNEL_SAVE == Channel && gVFO.Info[0].ConfigRX.Frequency == 14400000 + (Channel * 2500U), "a hop tuned the wrong channel");
+	}
+	// Before the index each hop also read the record in two halves and the name
+	OldReads = Reads + (200 * 3);
+	OldBytes = BusBytes + (200 * ((4 + 8) + (4 + 8) + (4 + 16)));
+
+	printf("  before the index %u reads, %3u bus bytes, %5.2f ms of I2C per hop\n", OldReads / 200, OldBytes / 200, OldBytes * I2C_BYTE_US / 200000.0);
+	printf("  with the index   %u reads, %3u bus bytes, %5.2f ms of I2C per hop\n", Reads / 200, BusBytes / 200, BusBytes * I2C_BYTE_US / 200000.0);
+	printf("  index of 200 channels: %u bytes of RAM, %u as a copy of the records\n", (unsigned)sizeof(gMR_Channels), 200U * 16U);
+	Check(sizeof(MR_Channel_t) == 12, "MR_Channel_t is not 12 bytes");
+}
+
+int main(void)
+{
+	Decode();
+	Hops();
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,140 @@
+// Checks DCS_GetCdcssCode() against the decoder it replaced, which
+// recomputed the Golay check bits of every candidate, for every 23 bit
+// input, and times both.
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "dcs.h"
+
+static uint32_t OldCalculateGolay(uint32_t CodeWord)
+{
+	uint32_t Word;
+	uint8_t i;
+
+	Word = CodeWord;
+	for (i = 0; i < 12; i++) {
+		Word <<= 1;
+		if (Word & 0x1000) {
+			Word ^= 0x08EA;
+		}
+	}
+	return CodeWord | ((Word & 0x0FFE) << 11);
+}
+
+static uint8_t OldGetCdcssCode(uint32_t Code)
+{
+	uint8_t i;
+
+	for (i = 0; i < 23; i++) {
+		uint32_t Shift;
+
+		if (((Code >> 9) & 0x7U) == 4) {
+			uint8_t j;
+
+			for (j = 0; j < 104; j++) {
+				if (DCS_Options[j] == (Code & 0x1FF)) {
+					if (OldCalculateGolay(DCS_Options[j] + 0x800U) == Code) {
+						return j;
+					}
+				}
+			}
+		}
+		Shift = Code >> 1;
+		if (Code & 1U) {
+			Shift |= 0x400000U;
+		}
+		Code = Shift;
+	}
+
+	return 0xFF;
+}
+
+static double Now(void)
+{
+	struct timespec Time;
+
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+
+	return Time.tv_sec + (Time.tv_nsec / 1e9);
+}
+
+int main(void)
+{
+	static uint32_t Rotations[104 * 2 * 23];
+	volatile uint32_t Sink = 0;
+	uint32_t Failures = 0;
+	uint32_t Found = 0;
+	uint32_t Code;
+	double Start;
+	double Old;
+	double New;
+	uint32_t i, j;
+
+	for (Code = 0; Code < 0x800000; Code++) {
+		const uint8_t Expected = OldGetCdcssCode(Code);
+
+		if (DCS_GetCdcssCode(Code) != Expected) {
+			if (Failures++ < 10) {
+				printf("  %06X decodes to %u, was %u\n", Code, DCS_GetCdcssCode(Code), Expected);
+			}
+		}
+		if (Expected != 0xFF) {
+			Found++;
+		}
+	}
+	printf("%u inputs, %u decode to an option, %u differ\n", Code, Found, Failures);
+
+	for (i = 0; i < 104; i++) {
+		if (DCS_GetGolayCodeWord(CODE_TYPE_DIGITAL, i) != OldCalculateGolay(DCS_Options[i] + 0x800U)) {
+			printf("  code word %u differs\n", i);
+			Failures++;
+		}
+	}
+
+	// What the BK4819 hands over while receiving: some rotation of a code
+	// word, either polarity
+	for (i = 0; i < 104 * 2; i++) {
+		uint32_t Word = DCS_GetGolayCodeWord(CODE_TYPE_DIGITAL + (i & 1), i / 2);
+
+		for (j = 0; j < 23; j++) {
+			Rotations[(i * 23) + j] = Word;
+			Word = (Word >> 1) | ((Word & 1U) << 22);
+		}
+	}
+
+	Start = Now();
+	for (Code = 0; Code < 0x800000; Code++) {
+		Sink += OldGetCdcssCode(Code);
+	}
+	Old = 0x800000 / (Now() - Start);
+	Start = Now();
+	for (Code = 0; Code < 0x800000; Code++) {
+		Sink += DCS_GetCdcssCode(Code);
+	}
+	New = 0x800000 / (Now() - Start);
+	printf("all inputs      %5.2fM decodes/s, was %5.2fM\n", New / 1e6, Old / 1e6);
+
+	Start = Now();
+	for (i = 0; i < 100; i++) {
+		for (j = 0; j < 104 * 2 * 23; j++) {
+			Sink += OldGetCdcssCode(Rotations[j]);
+		}
+	}
+	Old = (100.0 * 104 * 2 * 23) / (Now() - Start);
+	Start = Now();
+	for (i = 0; i < 100; i++) {
+		for (j = 0; j < 104 * 2 * 23; j++) {
+			Sink += DCS_GetCdcssCode(Rotations[j]);
+		}
+	}
+	New = (100.0 * 104 * 2 * 23) / (Now() - Start);
+	printf("rotated words   %5.2fM decodes/s, was %5.2fM\n", New / 1e6, Old / 1e6);
+
+	(void)Sink;
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
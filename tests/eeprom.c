@@ -0,0 +1,341 @@
+// Runs driver/eeprom.c against a model of the BL24C64 behind the I2C calls.
+// The model programs a page on the stop that ends a write, wraps inside the
+// page like the device, and does not answer its address for the length of
+// the write cycle. Checks page splitting, skipping unchanged pages, ACK
+// polling and the fallback delay when polls go unanswered.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "driver/eeprom.h"
+#include "driver/i2c.h"
+
+// Start, one byte and stop of a poll come to about 60 us on this bus
+#define START_US 10.0
+#define BYTE_US 40.0
+#define STOP_US 10.0
+
+enum {
+	STATE_IDLE,
+	STATE_DEVICE,
+	STATE_ADDRESS_HIGH,
+	STATE_ADDRESS_LOW,
+	STATE_WRITE,
+	STATE_READ,
+	STATE_IGNORED,
+};
+
+static uint8_t Memory[EEPROM_SIZE];
+static uint8_t PageBuffer[EEPROM_PAGE_SIZE];
+static uint8_t PageBytes;
+static uint16_t Pointer;
+static uint8_t State;
+static double Now;
+static double BusyUntil;
+static double WriteCycleUs = 5000.0;
+
+static uint32_t PageWrites;
+static uint32_t Wraps;
+static uint32_t BusyAccesses;
+static uint32_t Polls;
+static uint32_t FallbackDelays;
+
+static int Failures;
+
+static void Check(bool bOk, const char *pWhat)
+{
+	if (!bOk) {
+		printf("  FAILED: %s\n", pWhat);
+		Failures++;
+	}
+}
+
+static bool IsBusy(void)
+{
+	return Now < BusyUntil;
+}
+
+void I2C_Start(void)
+{
+	Now += START_US;
+	State = STATE_DEVICE;
+	PageBytes = 0;
+}
+
+void I2C_Stop(void)
+{
+	Now += STOP_US;
+	if (State == STATE_WRITE && PageBytes) {
+		const uint16_t Page = Pointer & ~(EEPROM_PAGE_SIZE - 1);
+		uint8_t Offset = Pointer % EEPROM_PAGE_SIZE;
+		uint8_t i;
+
+		if (Offset + PageBytes > EEPROM_PAGE_SIZE) {
+			Wraps++;
+		}
+		for (i = 0; i < PageBytes && i < EEPROM_PAGE_SIZE; i++) {
+			Memory[Page + Offset] = PageBuffer[i];
+			Offset = (Offset + 1) % EEPROM_PAGE_SIZE;
+		}
+		PageWrites++;
+		BusyUntil = Now + WriteCycleUs;
+	}
+	State = STATE_IDLE;
+}
+
+static bool Send(uint8_t Data)
+{
+	Now += BYTE_US;
+
+	switch (State) {
+	case STATE_DEVICE:
+		if (IsBusy()) {
+			State = STATE_IGNORED;
+			return false;
+		}
+		if (Data == 0xA0) {
+			State = STATE_ADDRESS_HIGH;
+		} else if (Data == 0xA1) {
+			State = STATE_READ;
+		} else {
+			State = STATE_IGNORED;
+			return false;
+		}
+		return true;
+
+	case STATE_ADDRESS_HIGH:
+		Pointer = (Data << 8) & (EEPROM_SIZE - 1);
+		State = STATE_ADDRESS_LOW;
+		return true;
+
+	case STATE_ADDRESS_LOW:
+		Pointer |= Data;
+		State = STATE_WRITE;
+		return true;
+
+	case STATE_WRITE:
+		if (PageBytes < EEPROM_PAGE_SIZE) {
+			PageBuffer[PageBytes] = Data;
+		}
+		PageBytes++;
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+bool I2C_Write(uint8_t Data)
+{
+	// The driver spins on the acknowledge here, which would hang the radio
+	if (!Send(Data)) {
+		BusyAccesses++;
+	}
+
+	return false;
+}
+
+bool I2C_TryWrite(uint8_t Data)
+{
+	Polls++;
+
+	return Send(Data);
+}
+
+int I2C_ReadBuffer(void *pBuffer, uint8_t Size)
+{
+	uint8_t *pData = (uint8_t *)pBuffer;
+	uint8_t i;
+
+	if (State != STATE_READ) {
+		BusyAccesses++;
+	}
+	for (i = 0; i < Size; i++) {
+		Now += BYTE_US;
+		pData[i] = Memory[Pointer];
+		Pointer = (Pointer + 1) % EEPROM_SIZE;
+	}
+
+	return Size;
+}
+
+bool I2C_WriteBuffer(const void *pBuffer, uint8_t Size)
+{
+	const uint8_t *pData = (const uint8_t *)pBuffer;
+	uint8_t i;
+
+	for (i = 0; i < Size; i++) {
+		I2C_Write(pData[i]);
+	}
+
+	return false;
+}
+
+void SYSTEM_DelayMs(uint32_t Delay)
+{
+	FallbackDelays++;
+	Now += Delay * 1000.0;
+}
+
+static void ResetCounters(void)
+{
+	PageWrites = 0;
+	Wraps = 0;
+	BusyAccesses = 0;
+	Polls = 0;
+	FallbackDelays = 0;
+	memset(&gEEPROM_Stats, 0, sizeof(gEEPROM_Stats));
+}
+
+// Pages from Address to Address + Size that hold at least one new byte
+static uint32_t ChangedPages(uint16_t Address, const uint8_t *pData, uint16_t Size)
+{
+	uint32_t Pages = 0;
+	uint16_t i = 0;
+
+	while (i < Size) {
+		const uint16_t End = ((Address + i) | (EEPROM_PAGE_SIZE - 1)) + 1 - Address;
+		bool bChanged = false;
+
+		for (; i < Size && i < End; i++) {
+			if (Memory[Address + i] != pData[i]) {
+				bChanged = true;
+			}
+		}
+		Pages += bChanged;
+	}
+
+	return Pages;
+}
+
+static void PageSplitting(void)
+{
+	static uint8_t Expected[EEPROM_SIZE];
+	uint8_t Data[256];
+	uint32_t Pages;
+	uint32_t Writes = 0;
+	uint32_t i, j;
+
+	printf("page splitting\n");
+	for (i = 0; i < 2000; i++) {
+		const uint16_t Size = 1 + (rand() % sizeof(Data));
+		const uint16_t Address = rand() % (EEPROM_SIZE - Size + 1);
+
+		for (j = 0; j < Size; j++) {
+			// Leave some bytes as they are so some pages are unchanged
+			Data[j] = (rand() % 4) ? rand() : Memory[Address + j];
+		}
+		memcpy(Expected, Memory, EEPROM_SIZE);
+		memcpy(Expected + Address, Data, Size);
+		Pages = ChangedPages(Address, Data, Size);
+
+		ResetCounters();
+		EEPROM_WriteBlock(Address, Data, Size);
+		Writes += PageWrites;
+		Check(PageWrites == Pages, "a changed page was not written once");
+		Check(gEEPROM_Stats.PageWrites == Pages, "PageWrites is off");
+		Check(Wraps == 0, "a page write wrapped around");
+		Check(BusyAccesses == 0, "the device was accessed during a write cycle");
+		Check(FallbackDelays == 0, "the fallback delay ran");
+		Check(memcmp(Expected, Memory, EEPROM_SIZE) == 0, "the EEPROM differs");
+		if (Failures) {
+			printf("  at %04X, %u bytes\n", Address, Size);
+			return;
+		}
+	}
+	printf("  2000 random blocks, %u page writes, all as expected\n", Writes);
+}
+
+static void UnchangedPages(void)
+{
+	uint8_t Data[100];
+
+	printf("unchanged pages\n");
+	memcpy(Data, Memory + 0x0110, sizeof(Data));
+	ResetCounters();
+	EEPROM_WriteBlock(0x0110, Data, sizeof(Data));
+	Check(PageWrites == 0, "an unchanged page was written");
+	// 0x0110 to 0x0174 touches 4 pages
+	Check(gEEPROM_Stats.PagesSkipped == 4, "PagesSkipped is not 4");
+	Check(Polls == 0, "polled without a write");
+
+	Data[50] ^= 0xFF;
+	ResetCounters();
+	EEPROM_WriteBlock(0x0110, Data, sizeof(Data));
+	Check(PageWrites == 1, "one changed byte took more than one page write");
+	Check(gEEPROM_Stats.PagesSkipped == 3, "PagesSkipped is not 3");
+	Check(Memory[0x0110 + 50] == Data[50], "the changed byte was not written");
+}
+
+static void AckPolling(void)
+{
+	uint8_t Data[EEPROM_PAGE_SIZE];
+	double Start;
+
+	printf("ACK polling\n");
+	memset(Data, 0x11, sizeof(Data));
+	ResetCounters();
+	Start = Now;
+	EEPROM_WriteBlock(0x0400, Data, sizeof(Data));
+	printf("  5 ms write cycle: %u busy polls, %.2f ms\n", gEEPROM_Stats.BusyPolls, (Now - Start) / 1000.0);
+	Check(FallbackDelays == 0, "the fallback delay ran");
+	Check(!IsBusy(), "returned before the write cycle ended");
+	Check(Now - BusyUntil <= START_US + BYTE_US + STOP_US, "returned more than a poll after the write cycle ended");
+
+	// A device that stays busy past EEPROM_WRITE_POLL_LIMIT polls
+	WriteCycleUs = 15000.0;
+	memset(Data, 0x22, sizeof(Data));
+	ResetCounters();
+	Start = Now;
+	EEPROM_WriteBlock(0x0400, Data, sizeof(Data));
+	EEPROM_WriteBlock(0x0420, Data, sizeof(Data));
+	printf("  15 ms write cycle: %u busy polls, %u fallback delays, %.2f ms\n", gEEPROM_Stats.BusyPolls, FallbackDelays, (Now - Start) / 1000.0);
+	Check(gEEPROM_Stats.BusyPolls == 2 * EEPROM_WRITE_POLL_LIMIT, "did not give up after EEPROM_WRITE_POLL_LIMIT polls");
+	Check(FallbackDelays == 2, "the fallback delay did not run after each write");
+	Check(BusyAccesses == 0, "the device was accessed during a write cycle");
+	Check(memcmp(Memory + 0x0400, Data, sizeof(Data)) == 0 && memcmp(Memory + 0x0420, Data, sizeof(Data)) == 0, "the pages differ");
+	WriteCycleUs = 5000.0;
+}
+
+static void DeferredWrites(void)
+{
+	uint8_t Data[8];
+	uint8_t Read[24];
+
+	printf("deferred writes\n");
+	ResetCounters();
+	memset(Data, 0x33, sizeof(Data));
+	EEPROM_WriteDeferred(0x0800, Data);
+	memset(Data, 0x44, sizeof(Data));
+	EEPROM_WriteDeferred(0x0808, Data);
+	EEPROM_WriteDeferred(0x0800, Data);
+	Check(PageWrites == 0, "a deferred block was written early");
+	EEPROM_ReadBuffer(0x07FC, Read, sizeof(Read));
+	Check(Read[4] == 0x44 && Read[12] == 0x44 && Read[3] == Memory[0x07FF], "a read missed the pending blocks");
+
+	// Overlapping the pending blocks flushes them first
+	memset(Data, 0x55, sizeof(Data));
+	EEPROM_WriteBlock(0x0804, Data, 4);
+	Check(Memory[0x0800] == 0x44 && Memory[0x0804] == 0x55 && Memory[0x0808] == 0x44, "the overlapping write came out of order");
+	Check(!EEPROM_HasPending(), "blocks are still pending");
+	Check(PageWrites == 2, "the flush and the write took more than two page writes");
+	Check(BusyAccesses == 0, "the device was accessed during a write cycle");
+}
+
+int main(void)
+{
+	uint32_t i;
+
+	srand(1);
+	for (i = 0; i < EEPROM_SIZE; i++) {
+		Memory[i] = rand();
+	}
+
+	PageSplitting();
+	UnchangedPages();
+	AckPolling();
+	DeferredWrites();
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
@@ -0,0 +1,231 @@
+// Checks helper/format.c against the host sprintf, first for every field
+// width on a sweep of values, then for each line the UI used to build with
+// sprintf, and times both.
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "helper/format.h"
+
+#define BENCH_CALLS 2000000U
+
+static int Failures;
+static uint32_t Cases;
+
+static void Compare(const char *pFormat, const char *pExpected, const char *pString, const char *pEnd)
+{
+	Cases++;
+	if (strcmp(pExpected, pString) || pEnd != pString + strlen(pString)) {
+		if (Failures++ < 20) {
+			printf("  \"%s\": \"%s\" from sprintf, \"%s\" from FORMAT\n", pFormat, pExpected, pString);
+		}
+	}
+}
+
+// Every value up to 10^5, the values around each power of two and ten and
+// random 32 bit values
+static uint32_t Values[100000 + (10 * 2001) + (32 * 3) + 100000];
+static uint32_t ValueCount;
+
+static void MakeValues(void)
+{
+	uint32_t Power = 10;
+	uint32_t i;
+	int32_t j;
+
+	for (i = 0; i < 100000; i++) {
+		Values[ValueCount++] = i;
+	}
+	for (i = 0; i < 10; i++) {
+		for (j = -1000; j <= 1000; j++) {
+			Values[ValueCount++] = Power + j;
+		}
+		Power = (Power < 1000000000U) ? Power * 10 : 0xFFFFFC17U;
+	}
+	for (i = 0; i < 32; i++) {
+		Values[ValueCount++] = (1U << i) - 1;
+		Values[ValueCount++] = 1U << i;
+		Values[ValueCount++] = (1U << i) + 1;
+	}
+	for (i = 0; i < 100000; i++) {
+		Values[ValueCount++] = ((uint32_t)rand() << 16) ^ (uint32_t)rand();
+	}
+}
+
+static void CheckFields(void)
+{
+	static const uint32_t Powers[10] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+	char Expected[64];
+	char String[64];
+	uint32_t i;
+	uint8_t Width;
+
+	for (i = 0; i < ValueCount; i++) {
+		const uint32_t Value = Values[i];
+
+		for (Width = 0; Width <= 10; Width++) {
+			sprintf(Expected, "%0*u", Width, Value);
+			Compare("%0*u", Expected, String, FORMAT_Unsigned(String, Value, Width));
+			sprintf(Expected, "%*u", Width, Value);
+			Compare("%*u", Expected, String, FORMAT_Aligned(String, Value, Width));
+			if (Width <= 8) {
+				sprintf(Expected, "%0*x", Width, Value);
+				Compare("%0*x", Expected, String, FORMAT_Hex(String, Value, Width));
+			}
+			sprintf(Expected, "%0*o", Width + 1, Value);
+			Compare("%0*o", Expected, String, FORMAT_Octal(String, Value, Width + 1));
+			if (Width >= 1 && Width < 10) {
+				sprintf(Expected, "%u.%0*u", Value / Powers[Width], Width, Value % Powers[Width]);
+				Compare("%u.%0*u", Expected, String, FORMAT_Fixed(String, Value, Width));
+			}
+		}
+	}
+}
+
+// The UI lines, with the sprintf each one replaced. Values cover the range
+// the callers pass and past it.
+static void CheckLines(void)
+{
+	// %#4u is %4u, the # flag means nothing for %u
+	const char *pAligned = "%u.%02uV-%#4u";
+	char Expected[64];
+	char String[64];
+	char *pString;
+	uint32_t i;
+
+	for (i = 0; i < 100000; i++) {
+		sprintf(Expected, "%u", i);
+		Compare("%u", Expected, String, FORMAT_Unsigned(String, i, 0));
+		sprintf(Expected, "%umin", i);
+		Compare("%umin", Expected, String, FORMAT_String(FORMAT_Unsigned(String, i, 0), "min"));
+		sprintf(Expected, "%u*100ms", i);
+		Compare("%u*100ms", Expected, String, FORMAT_String(FORMAT_Unsigned(String, i, 0), "*100ms"));
+		sprintf(Expected, "%u*10ms", i);
+		Compare("%u*10ms", Expected, String, FORMAT_String(FORMAT_Unsigned(String, i, 0), "*10ms"));
+		sprintf(Expected, "%us", i);
+		Compare("%us", Expected, String, FORMAT_Char(FORMAT_Unsigned(String, i, 0), 's'));
+		sprintf(Expected, "LIST%u", i);
+		Compare("LIST%u", Expected, String, FORMAT_Unsigned(FORMAT_String(String, "LIST"), i, 0));
+		sprintf(Expected, "PRI1:%u", i);
+		Compare("PRI1:%u", Expected, String, FORMAT_Unsigned(FORMAT_String(String, "PRI1:"), i, 0));
+		sprintf(Expected, "A-SCAN(%u)", i);
+		Compare("A-SCAN(%u)", Expected, String, FORMAT_Char(FORMAT_Unsigned(FORMAT_String(String, "A-SCAN("), i, 0), ')'));
+		sprintf(Expected, "VFO(CH%02u)", i);
+		Compare("VFO(CH%02u)", Expected, String, FORMAT_Char(FORMAT_Unsigned(FORMAT_String(String, "VFO(CH"), i, 2), ')'));
+		sprintf(Expected, "CH-%02u", i);
+		Compare("CH-%02u", Expected, String, FORMAT_Unsigned(FORMAT_String(String, "CH-"), i, 2));
+		sprintf(Expected, "CH-%03u", i);
+		Compare("CH-%03u", Expected, String, FORMAT_Unsigned(FORMAT_String(String, "CH-"), i, 3));
+		sprintf(Expected, "%03u", i);
+		Compare("%03u", Expected, String, FORMAT_Unsigned(String, i, 3));
+		sprintf(Expected, "%04x", i);
+		Compare("%04x", Expected, String, FORMAT_Hex(String, i, 4));
+		sprintf(Expected, "MDC1200 ID %04x", i);
+		Compare("MDC1200 ID %04x", Expected, String, FORMAT_Hex(FORMAT_String(String, "MDC1200 ID "), i, 4));
+		sprintf(Expected, "D%03oN", i);
+		Compare("D%03oN", Expected, String, FORMAT_Char(FORMAT_Octal(FORMAT_Char(String, 'D'), i, 3), 'N'));
+		sprintf(Expected, "DCS:D%03oN", i);
+		Compare("DCS:D%03oN", Expected, String, FORMAT_Char(FORMAT_Octal(FORMAT_String(String, "DCS:D"), i, 3), 'N'));
+		sprintf(Expected, "%u.%02ukHz", i / 100, i % 100);
+		Compare("%u.%02ukHz", Expected, String, FORMAT_String(FORMAT_Fixed(String, i, 2), "kHz"));
+		sprintf(Expected, "%u.%01uHz", i / 10, i % 10);
+		Compare("%u.%01uHz", Expected, String, FORMAT_String(FORMAT_Fixed(String, i, 1), "Hz"));
+		sprintf(Expected, "CTC:%u.%01uHz", i / 10, i % 10);
+		Compare("CTC:%u.%01uHz", Expected, String, FORMAT_String(FORMAT_Fixed(FORMAT_String(String, "CTC:"), i, 1), "Hz"));
+		sprintf(Expected, pAligned, i / 100, i % 100, i % 10000);
+		Compare(pAligned, Expected, String, FORMAT_Aligned(FORMAT_String(FORMAT_Fixed(String, i, 2), "V-"), i % 10000, 4));
+		sprintf(Expected, "%u/s %uK", i % 1000, i);
+		pString = FORMAT_String(FORMAT_Unsigned(String, i % 1000, 0), "/s ");
+		Compare("%u/s %uK", Expected, String, FORMAT_Char(FORMAT_Unsigned(pString, i, 0), 'K'));
+	}
+
+	// Frequencies in 10 Hz units, 10 MHz to 1.3 GHz in 1.25 kHz steps
+	for (i = 1000000; i <= 130000000; i += 125) {
+		sprintf(Expected, "%u.%05u", i / 100000, i % 100000);
+		Compare("%u.%05u", Expected, String, FORMAT_Fixed(String, i, 5));
+		sprintf(Expected, "FREQ:%u.%05u", i / 100000, i % 100000);
+		Compare("FREQ:%u.%05u", Expected, String, FORMAT_Fixed(FORMAT_String(String, "FREQ:"), i, 5));
+		sprintf(Expected, "%u.%03u %u.%02uK", i / 100000, (i % 100000) / 100, (i % 10000) / 100, (i % 10000) % 100);
+		pString = FORMAT_Char(FORMAT_Fixed(String, i / 100, 3), ' ');
+		Compare("%u.%03u %u.%02uK", Expected, String, FORMAT_Char(FORMAT_Fixed(pString, i % 10000, 2), 'K'));
+	}
+
+	for (i = 0; i < 256; i++) {
+		char Text[16];
+
+		memset(Text, 'A' + (i % 26), i % 16);
+		Text[i % 16] = 0;
+		sprintf(Expected, "%s%c%s", Text, (char)('0' + i % 10), "AAAAA");
+		Compare("%s%c%s", Expected, String, FORMAT_String(FORMAT_Char(FORMAT_String(String, Text), '0' + i % 10), "AAAAA"));
+		sprintf(Expected, ">%s", Text);
+		Compare(">%s", Expected, String, FORMAT_String(FORMAT_Char(String, '>'), Text));
+		sprintf(Expected, "CALL:%s", Text);
+		Compare("CALL:%s", Expected, String, FORMAT_String(FORMAT_String(String, "CALL:"), Text));
+	}
+}
+
+static double Now(void)
+{
+	struct timespec Time;
+
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+
+	return (Time.tv_sec * 1e9) + Time.tv_nsec;
+}
+
+// The frequency line is the one redrawn most, the rest are menu values
+static void Benchmark(void)
+{
+	volatile uint32_t Sink = 0;
+	char String[64];
+	double Start;
+	double Sprintf;
+	double Format;
+	uint32_t i;
+
+	Start = Now();
+	for (i = 0; i < BENCH_CALLS; i++) {
+		const uint32_t Frequency = 14400000 + i;
+
+		Sink += sprintf(String, "%u.%05u", Frequency / 100000, Frequency % 100000);
+	}
+	Sprintf = (Now() - Start) / BENCH_CALLS;
+
+	Start = Now();
+	for (i = 0; i < BENCH_CALLS; i++) {
+		Sink += FORMAT_Fixed(String, 14400000 + i, 5) - String;
+	}
+	Format = (Now() - Start) / BENCH_CALLS;
+	printf("%%u.%%05u    sprintf %6.1f ns, FORMAT_Fixed    %6.1f ns\n", Sprintf, Format);
+
+	Start = Now();
+	for (i = 0; i < BENCH_CALLS; i++) {
+		Sink += sprintf(String, "CH-%03u", (i % 200) + 1);
+	}
+	Sprintf = (Now() - Start) / BENCH_CALLS;
+
+	Start = Now();
+	for (i = 0; i < BENCH_CALLS; i++) {
+		Sink += FORMAT_Unsigned(FORMAT_String(String, "CH-"), (i % 200) + 1, 3) - String;
+	}
+	Format = (Now() - Start) / BENCH_CALLS;
+	printf("CH-%%03u     sprintf %6.1f ns, FORMAT_Unsigned %6.1f ns\n", Sprintf, Format);
+
+	(void)Sink;
+}
+
+int main(void)
+{
+	srand(1);
+	MakeValues();
+	CheckFields();
+	CheckLines();
+	printf("%u strings checked against sprintf, %u differ\n", Cases, Failures);
+	Benchmark();
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
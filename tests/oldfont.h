@@ -0,0 +1,12 @@
+#ifndef TESTS_OLDFONT_H
+#define TESTS_OLDFONT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// UI_PrintString() and UI_DisplayFrequency() as they were before gFontColumns
+void OLD_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Line, uint8_t Width, bool bCentered);
+void OLD_DisplayFrequency(const char *pDigits, uint8_t X, uint8_t Y, bool bDisplayLeadingZero, bool bFlag);
+
+#endif
+
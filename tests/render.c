@@ -0,0 +1,214 @@
+// Host build of the ST7565 driver. Draws a few typical screens through the
+// UI helpers and reports how many bytes each update puts on the SPI bus.
+// SPI0 and GPIOB are plain structs here, so only the counters in
+// gST7565_Stats and the shadow are meaningful. Also checks that the big
+// fonts draw the same as the old tables in tests/oldfont.c.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bsp/dp32g030/gpio.h"
+#include "bsp/dp32g030/spi.h"
+
+static SPI_Port_t FakeSpi;
+static GPIO_Bank_t FakeGpio;
+
+#undef SPI0
+#undef GPIOB
+#define SPI0 (&FakeSpi)
+#define GPIOB (&FakeGpio)
+
+#include "driver/st7565.c"
+#include "tests/oldfont.h"
+#include "ui/helper.h"
+
+#define FULL_BLIT_BYTES (1 + (7 * (3 + 128)))
+
+BOARD_BootStats_t gBootStats;
+
+uint32_t SCHEDULER_GetTimeUs(void)
+{
+	return 1;
+}
+
+void SPI0_Init(void)
+{
+}
+
+void SPI_WaitForUndocumentedTxFifoStatusBit(void)
+{
+}
+
+void SPI_DisableMasterMode(volatile uint32_t *pCR)
+{
+	(void)pCR;
+}
+
+void SPI_EnableMasterMode(volatile uint32_t *pCR)
+{
+	(void)pCR;
+}
+
+void GPIO_SetBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	*pReg |= 1U << Bit;
+}
+
+void GPIO_ClearBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	*pReg &= ~(1U << Bit);
+}
+
+static uint32_t LastBytes;
+static int Failures;
+
+static void Report(const char *pName, uint32_t Expected)
+{
+	const uint32_t Bytes = gST7565_Stats.DataBytes + gST7565_Stats.CommandBytes - LastBytes;
+	uint8_t Line;
+
+	printf("%-24s %4u bytes\n", pName, Bytes);
+	LastBytes += Bytes;
+
+	for (Line = 0; Line < 7; Line++) {
+		if (memcmp(gShadow[Line + 1], gFrameBuffer[Line], 128)) {
+			printf("  page %u differs from the frame buffer\n", Line + 1);
+			Failures++;
+		}
+	}
+	if (memcmp(gShadow[0], gStatusLine, 128)) {
+		printf("  status line differs\n");
+		Failures++;
+	}
+	if (Bytes != Expected) {
+		printf("  expected %u bytes\n", Expected);
+		Failures++;
+	}
+}
+
+// The main screen of a VFO pair, frequencies in Hz / 10
+static void DrawMain(uint32_t FrequencyA, uint32_t FrequencyB, uint8_t Rssi)
+{
+	char DigitsA[8];
+	char DigitsB[8];
+	uint8_t i;
+
+	for (i = 0; i < 8; i++) {
+		DigitsA[7 - i] = FrequencyA % 10;
+		DigitsB[7 - i] = FrequencyB % 10;
+		FrequencyA /= 10;
+		FrequencyB /= 10;
+	}
+
+	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+	UI_PrintString("VFO", 0, 0, 0, 8, false);
+	UI_DisplayFrequency(DigitsA, 31, 1, false, false);
+	UI_DisplaySmallDigits(2, DigitsA + 6, 112, 2);
+	UI_DisplayFrequency(DigitsB, 31, 5, false, false);
+	for (i = 0; i < Rssi; i++) {
+		gFrameBuffer[2][i * 3] = 0xFF;
+	}
+	ST7565_BlitFullScreen();
+}
+
+static void DrawMenu(const char *pName, const char *pValue)
+{
+	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+	UI_PrintString(pName, 0, 50, 0, 8, false);
+	UI_PrintString(pValue, 50, 127, 2, 8, true);
+	ST7565_BlitFullScreen();
+}
+
+static void DrawStatus(uint8_t Battery)
+{
+	memset(gStatusLine, 0, sizeof(gStatusLine));
+	memset(gStatusLine + 110, 0x7E, Battery);
+	ST7565_BlitStatusLine();
+}
+
+static uint8_t Expected[sizeof(gFrameBuffer)];
+
+static void CheckGlyphs(const char *pWhat, uint32_t *pCases)
+{
+	(*pCases)++;
+	if (memcmp(Expected, gFrameBuffer, sizeof(gFrameBuffer))) {
+		printf("  %s differs from the old font\n", pWhat);
+		Failures++;
+	}
+}
+
+// Every printable character at every width the UI uses, and every digit
+// combination of UI_DisplayFrequency()
+static void CompareFonts(void)
+{
+	static const uint8_t Widths[] = { 7, 8, 10, 12 };
+	uint32_t Cases = 0;
+	char String[4];
+	char Digits[6];
+	uint32_t i, j;
+
+	String[3] = 0;
+	for (i = ' '; i < 0x7F; i++) {
+		String[0] = i;
+		String[1] = 0x7E - (i - ' ');
+		String[2] = ' ' + ((i * 7) % 95);
+		for (j = 0; j < sizeof(Widths) * 2; j++) {
+			memset(gFrameBuffer, 0xAA, sizeof(gFrameBuffer));
+			OLD_PrintString(String, 20, 120, 3, Widths[j / 2], j & 1);
+			memcpy(Expected, gFrameBuffer, sizeof(Expected));
+			memset(gFrameBuffer, 0xAA, sizeof(gFrameBuffer));
+			UI_PrintString(String, 20, 120, 3, Widths[j / 2], j & 1);
+			CheckGlyphs(String, &Cases);
+		}
+	}
+
+	for (i = 0; i < 11 * 11 * 11 * 4; i++) {
+		Digits[0] = (i / 4) % 11;
+		Digits[1] = (i / 44) % 11;
+		Digits[2] = (i / 484) % 11;
+		Digits[3] = Digits[2];
+		Digits[4] = Digits[0];
+		Digits[5] = Digits[1];
+		memset(gFrameBuffer, 0x55, sizeof(gFrameBuffer));
+		OLD_DisplayFrequency(Digits, 31, 1 + (i & 4), i & 1, i & 2);
+		memcpy(Expected, gFrameBuffer, sizeof(Expected));
+		memset(gFrameBuffer, 0x55, sizeof(gFrameBuffer));
+		UI_DisplayFrequency(Digits, 31, 1 + (i & 4), i & 1, i & 2);
+		CheckGlyphs("a frequency", &Cases);
+	}
+
+	printf("%u glyph renders checked against the old fonts\n", Cases);
+}
+
+int main(void)
+{
+	ST7565_Init();
+	LastBytes = gST7565_Stats.DataBytes + gST7565_Stats.CommandBytes;
+
+	DrawMain(14550000, 43350000, 0);
+	Report("main, first frame", FULL_BLIT_BYTES);
+	DrawMain(14550000, 43350000, 0);
+	Report("main, unchanged", 1);
+	DrawMain(14550000, 43350000, 4);
+	Report("main, RSSI bar", 14);
+	DrawMain(14551250, 43350000, 4);
+	Report("main, 12.5 kHz step", 64);
+	DrawMain(14650000, 43350000, 4);
+	Report("main, 1 MHz step", 122);
+	DrawMenu("SQL", "3");
+	Report("menu, enter", 444);
+	DrawMenu("SQL", "4");
+	Report("menu, value change", 21);
+	DrawStatus(18);
+	Report("status, first", 1 + 3 + 128);
+	DrawStatus(18);
+	Report("status, unchanged", 1);
+	DrawStatus(14);
+	Report("status, battery level", 8);
+
+	printf("full blit %u bytes\n", FULL_BLIT_BYTES);
+
+	CompareFonts();
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
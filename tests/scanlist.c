@@ -0,0 +1,224 @@
+// Checks the channel bitmaps in radio.c against the attribute walk they
+// replaced, on random channel tables of several densities, and times both.
+// radio.c is linked with unused sections dropped, so only the lookups and
+// the data they read are needed here.
+
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "frequencies.h"
+#include "misc.h"
+#include "radio.h"
+#include "settings.h"
+
+#define TABLES 200U
+
+uint8_t gMR_ChannelAttributes[FREQ_CHANNEL_LAST + 1];
+EEPROM_Config_t gEeprom;
+
+static uint32_t Failures;
+static uint32_t Cases;
+
+static bool OldCheckValidChannel(uint16_t Channel, bool bCheckScanList, uint8_t VFO)
+{
+	uint8_t Attributes;
+	uint8_t PriorityCh1;
+	uint8_t PriorityCh2;
+
+	if (!IS_MR_CHANNEL(Channel)) {
+		return false;
+	}
+
+	Attributes = gMR_ChannelAttributes[Channel];
+	if ((Attributes & MR_CH_BAND_MASK) > BAND7_470MHz) {
+		return false;
+	}
+
+	if (bCheckScanList) {
+		switch (VFO) {
+		case 0:
+			if ((Attributes & MR_CH_SCANLIST1) == 0) {
+				return false;
+			}
+			PriorityCh1 = gEeprom.SCANLIST_PRIORITY_CH1[0];
+			PriorityCh2 = gEeprom.SCANLIST_PRIORITY_CH2[0];
+			break;
+		case 1:
+			if ((Attributes & MR_CH_SCANLIST2) == 0) {
+				return false;
+			}
+			PriorityCh1 = gEeprom.SCANLIST_PRIORITY_CH1[1];
+			PriorityCh2 = gEeprom.SCANLIST_PRIORITY_CH2[1];
+			break;
+		default:
+			return true;
+		}
+		if (PriorityCh1 == Channel) {
+			return false;
+		}
+		if (PriorityCh2 == Channel) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static uint8_t OldFindNextChannel(uint8_t Channel, int8_t Direction, bool bCheckScanList, uint8_t VFO)
+{
+	uint8_t i;
+
+	for (i = 0; i <= MR_CHANNEL_LAST; i++) {
+		if (Channel == 0xFF) {
+			Channel = MR_CHANNEL_LAST;
+		} else if (Channel > MR_CHANNEL_LAST) {
+			Channel = MR_CHANNEL_FIRST;
+		}
+		if (OldCheckValidChannel(Channel, bCheckScanList, VFO)) {
+			return Channel;
+		}
+		Channel += Direction;
+	}
+
+	return 0xFF;
+}
+
+// Percent is the chance of a channel being usable, and of being in each list
+static uint8_t RandomAttributes(uint8_t Percent)
+{
+	uint8_t Attributes;
+
+	if ((uint8_t)(rand() % 100) >= Percent) {
+		// Empty, or a band the radio does not have
+		return (rand() & 1) ? 0xFF : (rand() & 0xC0) | (8 + (rand() % 8));
+	}
+	Attributes = rand() % (BAND7_470MHz + 1);
+	if ((uint8_t)(rand() % 100) < Percent) {
+		Attributes |= MR_CH_SCANLIST1;
+	}
+	if ((uint8_t)(rand() % 100) < Percent) {
+		Attributes |= MR_CH_SCANLIST2;
+	}
+
+	return Attributes | (rand() & 0x30);
+}
+
+static uint8_t RandomPriority(void)
+{
+	return (rand() & 3) ? rand() % (MR_CHANNEL_LAST + 1) : 0xFF;
+}
+
+static void Compare(void)
+{
+	static const int8_t Directions[2] = { RADIO_CHANNEL_UP, (int8_t)RADIO_CHANNEL_DOWN };
+	uint16_t Channel;
+	uint8_t VFO;
+	uint8_t i;
+
+	for (VFO = 0; VFO < 3; VFO++) {
+		for (i = 0; i < 4; i++) {
+			const bool bCheckScanList = i & 1;
+			const int8_t Direction = Directions[i / 2];
+
+			for (Channel = 0; Channel < 256; Channel++) {
+				const uint8_t Expected = OldFindNextChannel(Channel, Direction, bCheckScanList, VFO);
+				const uint8_t Found = RADIO_FindNextChannel(Channel, Direction, bCheckScanList, VFO);
+
+				Cases++;
+				if (Found != Expected && Failures++ < 10) {
+					printf("  from %u, direction %d, list %u, VFO %u: %u, was %u\n", Channel, Direction, bCheckScanList, VFO, Found, Expected);
+				}
+				Cases++;
+				if (RADIO_CheckValidChannel(Channel, bCheckScanList, VFO) != OldCheckValidChannel(Channel, bCheckScanList, VFO) && Failures++ < 10) {
+					printf("  channel %u, list %u, VFO %u: validity differs\n", Channel, bCheckScanList, VFO);
+				}
+			}
+		}
+	}
+}
+
+static void RandomTable(uint8_t Percent)
+{
+	uint8_t i;
+
+	for (i = MR_CHANNEL_FIRST; i <= MR_CHANNEL_LAST; i++) {
+		gMR_ChannelAttributes[i] = RandomAttributes(Percent);
+	}
+	gEeprom.SCANLIST_PRIORITY_CH1[0] = RandomPriority();
+	gEeprom.SCANLIST_PRIORITY_CH2[0] = RandomPriority();
+	gEeprom.SCANLIST_PRIORITY_CH1[1] = RandomPriority();
+	gEeprom.SCANLIST_PRIORITY_CH2[1] = RandomPriority();
+	RADIO_InitChannelBits();
+}
+
+static double Now(void)
+{
+	struct timespec Time;
+
+	clock_gettime(CLOCK_MONOTONIC, &Time);
+
+	return Time.tv_sec + (Time.tv_nsec / 1e9);
+}
+
+// Lookups per second of scan list 1 upwards, from every channel
+static void Benchmark(uint8_t Percent)
+{
+	volatile uint8_t Sink = 0;
+	double Start;
+	double Old;
+	double New;
+	uint32_t Table;
+	uint8_t i;
+
+	srand(Percent);
+	Old = 0;
+	New = 0;
+	for (Table = 0; Table < TABLES; Table++) {
+		RandomTable(Percent);
+		Start = Now();
+		for (i = MR_CHANNEL_FIRST; i <= MR_CHANNEL_LAST; i++) {
+			Sink += OldFindNextChannel(i, RADIO_CHANNEL_UP, true, 0);
+		}
+		Old += Now() - Start;
+		Start = Now();
+		for (i = MR_CHANNEL_FIRST; i <= MR_CHANNEL_LAST; i++) {
+			Sink += RADIO_FindNextChannel(i, RADIO_CHANNEL_UP, true, 0);
+		}
+		New += Now() - Start;
+	}
+	(void)Sink;
+
+	printf("%3u%% in list %7.2fM lookups/s, was %6.2fM\n", Percent, (TABLES * 200.0) / New / 1e6, (TABLES * 200.0) / Old / 1e6);
+}
+
+int main(void)
+{
+	static const uint8_t Densities[] = { 0, 1, 5, 20, 50, 90, 100 };
+	uint32_t Table;
+	uint32_t i;
+
+	srand(1);
+	for (Table = 0; Table < TABLES; Table++) {
+		RandomTable(Densities[Table % sizeof(Densities)]);
+		Compare();
+
+		// Channels edited one at a time, as SETTINGS_UpdateChannel() does
+		for (i = 0; i < 20; i++) {
+			const uint8_t Channel = rand() % (MR_CHANNEL_LAST + 1);
+
+			gMR_ChannelAttributes[Channel] = RandomAttributes(50);
+			RADIO_UpdateChannelBits(Channel);
+		}
+		Compare();
+	}
+	printf("%u lookups on %u tables, %u differ\n", Cases, TABLES, Failures);
+
+	for (i = 0; i < sizeof(Densities); i++) {
+		Benchmark(Densities[i]);
+	}
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
@@ -0,0 +1,287 @@
+// Replays RADIO_SetupRegisters() and the dual watch alternation against the
+// bus model in tests/bk4819sim.c, once through the BK4819 shadow and once
+// with the shadow forgotten after every frame, which is the driver as it
+// was before the shadow. Both runs must leave the chip the same, and the
+// shadowed run may only leave out reads and writes of values the chip
+// already holds. Also checks which registers the shadow never caches.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "driver/bk4819.h"
+#include "functions.h"
+#include "misc.h"
+#include "radio.h"
+#include "settings.h"
+#include "tests/bk4819sim.h"
+
+#define STEPS 400U
+
+EEPROM_Config_t gEeprom;
+EEPROM_VFO_t gVFO;
+bool gEnableSpeaker;
+CssScanMode_t gCssScanMode;
+
+static int Failures;
+
+static void Check(bool bOk, const char *pWhat)
+{
+	if (!bOk) {
+		printf("  FAILED: %s\n", pWhat);
+		Failures++;
+	}
+}
+
+void FUNCTION_Init(void)
+{
+}
+
+void FUNCTION_Select(FUNCTION_Type_t Function)
+{
+	(void)Function;
+}
+
+// app.c keeps DUALWATCH_Alternate() static and needs most of the firmware,
+// this is its body without the timer restart
+static void DualwatchAlternate(void)
+{
+	gEeprom.RX_VFO = !gEeprom.RX_VFO;
+	gRxVfo = &gVFO.Info[gEeprom.RX_VFO];
+
+	RADIO_SetupRegisters(false);
+}
+
+static void RandomProfile(RADIO_Profile_t *pProfile)
+{
+	static const uint8_t Modulations[4] = { MOD_FM, MOD_FM, MOD_AM, MOD_DIG };
+
+	pProfile->Frequency = 1440000 + ((rand() % 4000) * 125);
+	pProfile->Bandwidth = rand() % 2;
+	pProfile->Modulation = Modulations[rand() % 4];
+	pProfile->CodeType = rand() % 4;
+	pProfile->Code = (pProfile->CodeType == CODE_TYPE_CONTINUOUS_TONE) ? rand() % 50 : rand() % 104;
+	pProfile->SquelchOpenRSSI = 100 + (rand() % 4);
+	pProfile->SquelchCloseRSSI = 90 + (rand() % 4);
+	pProfile->SquelchOpenNoise = 40;
+	pProfile->SquelchCloseNoise = 50;
+	pProfile->SquelchCloseGlitch = 30;
+	pProfile->SquelchOpenGlitch = 20;
+}
+
+// One step of the replay: mostly dual watch flips, sometimes a VFO edit,
+// a frequency hop or a microphone setting, as the UI would make them.
+// Returns true for a dual watch flip.
+static bool Edit(uint32_t Seed)
+{
+	VFO_Info_t *pInfo;
+
+	srand(Seed);
+	pInfo = &gVFO.Info[rand() % 2];
+	switch (rand() % 8) {
+	case 0:
+		RandomProfile(&pInfo->Profile);
+		break;
+	case 1:
+		pInfo->Profile.Frequency += 125;
+		break;
+	case 2:
+		pInfo->DTMF_DECODING_ENABLE = !pInfo->DTMF_DECODING_ENABLE;
+		break;
+	case 3:
+		gEeprom.MIC_SENSITIVITY_TUNING = rand() % 32;
+		break;
+	default:
+		break;
+	}
+
+	// Status and FIFO registers move on their own
+	gSimRegisters[BK4819_REG_0C] = rand() & 3;
+	gSimRegisters[BK4819_REG_0B] = rand();
+	gSimRegisters[BK4819_REG_0D] = rand();
+	gSimRegisters[BK4819_REG_0E] = rand();
+	gSimRegisters[0x5E] = rand();
+	gSimRegisters[BK4819_REG_5F] = rand();
+
+	return rand() % 4;
+}
+
+static void Setup(bool bAlternate)
+{
+	SIM_BusClearLog();
+	if (bAlternate) {
+		DualwatchAlternate();
+	} else {
+		RADIO_SetupRegisters(false);
+	}
+}
+
+static void Start(bool bUncached)
+{
+	uint8_t i;
+
+	srand(12345);
+	for (i = 0; i < 128; i++) {
+		gSimRegisters[i] = rand();
+	}
+	memset(&gEeprom, 0, sizeof(gEeprom));
+	memset(&gVFO, 0, sizeof(gVFO));
+	RandomProfile(&gVFO.Info[0].Profile);
+	RandomProfile(&gVFO.Info[1].Profile);
+	gRxVfo = &gVFO.Info[0];
+
+	SIM_BusForgetShadow();
+	gSimBusUncached = bUncached;
+	BK4819_Init();
+	RADIO_InvalidateProfile();
+	gSimShadowErrors = 0;
+	gSimBusErrors = 0;
+}
+
+static uint32_t CountReads(const SIM_BusFrame_t *pLog, uint32_t Length)
+{
+	uint32_t Reads = 0;
+	uint32_t i;
+
+	for (i = 0; i < Length; i++) {
+		Reads += (pLog[i].Register & SIM_BUS_READ) != 0;
+	}
+
+	return Reads;
+}
+
+// Every write of the plain run is in the shadowed run, unless the chip
+// already held the value and the register is not volatile
+static bool SameWrites(const SIM_BusFrame_t *pPlain, uint32_t PlainLength, const uint16_t *pBefore)
+{
+	uint16_t Registers[128];
+	uint32_t Shadowed = 0;
+	uint32_t i;
+
+	memcpy(Registers, pBefore, sizeof(Registers));
+	for (i = 0; i < PlainLength; i++) {
+		const SIM_BusFrame_t *pFrame = &pPlain[i];
+
+		if (pFrame->Register & SIM_BUS_READ) {
+			continue;
+		}
+		while (Shadowed < gSimBusLogLength && (gSimBusLog[Shadowed].Register & SIM_BUS_READ)) {
+			Shadowed++;
+		}
+		if (Shadowed < gSimBusLogLength && gSimBusLog[Shadowed].Register == pFrame->Register && gSimBusLog[Shadowed].Value == pFrame->Value) {
+			Shadowed++;
+		} else if (Registers[pFrame->Register] != pFrame->Value || pFrame->Register == BK4819_REG_00) {
+			printf("  the write %02X %04X is missing\n", pFrame->Register, pFrame->Value);
+			return false;
+		}
+		Registers[pFrame->Register] = pFrame->Value;
+		if (pFrame->Register == BK4819_REG_02) {
+			Registers[BK4819_REG_0C] &= ~1U;
+		}
+	}
+	while (Shadowed < gSimBusLogLength && (gSimBusLog[Shadowed].Register & SIM_BUS_READ)) {
+		Shadowed++;
+	}
+
+	return Shadowed == gSimBusLogLength;
+}
+
+static void Replay(void)
+{
+	static SIM_BusFrame_t Plain[STEPS][200];
+	static uint32_t PlainLength[STEPS];
+	static uint16_t PlainRegisters[STEPS][128];
+	uint16_t Before[128];
+	uint32_t PlainReads = 0;
+	uint32_t PlainWrites = 0;
+	uint32_t Reads = 0;
+	uint32_t Writes = 0;
+	uint32_t i;
+
+	printf("replay of %u setups\n", STEPS);
+
+	Start(true);
+	for (i = 0; i < STEPS; i++) {
+		Setup(Edit(i));
+		Check(gSimBusLogLength <= 200, "a setup made more than 200 frames");
+		PlainLength[i] = gSimBusLogLength;
+		memcpy(Plain[i], gSimBusLog, gSimBusLogLength * sizeof(Plain[i][0]));
+		memcpy(PlainRegisters[i], gSimRegisters, sizeof(PlainRegisters[i]));
+		PlainReads += CountReads(gSimBusLog, gSimBusLogLength);
+		PlainWrites += gSimBusLogLength - CountReads(gSimBusLog, gSimBusLogLength);
+	}
+	Check(gSimBusErrors == 0, "bad frames without the shadow");
+
+	Start(false);
+	for (i = 0; i < STEPS; i++) {
+		const bool bAlternate = Edit(i);
+
+		memcpy(Before, gSimRegisters, sizeof(Before));
+		Setup(bAlternate);
+		Reads += CountReads(gSimBusLog, gSimBusLogLength);
+		Writes += gSimBusLogLength - CountReads(gSimBusLog, gSimBusLogLength);
+		if (memcmp(PlainRegisters[i], gSimRegisters, sizeof(gSimRegisters))) {
+			printf("  the chip differs after setup %u\n", i);
+			Failures++;
+			return;
+		}
+		if (!SameWrites(Plain[i], PlainLength[i], Before)) {
+			printf("  setup %u: the shadow changed the writes\n", i);
+			Failures++;
+			return;
+		}
+	}
+	Check(gSimBusErrors == 0, "bad frames with the shadow");
+	Check(gSimShadowErrors == 0, "the shadow disagreed with the chip");
+
+	printf("  without the shadow %5u reads %5u writes\n", PlainReads, PlainWrites);
+	printf("  with the shadow    %5u reads %5u writes, same chip after every setup\n", Reads, Writes);
+}
+
+// Writes, changes the chip behind the driver's back, reads and writes again.
+// Only a register outside the shadow sees the change and the second write.
+static void VolatileSet(void)
+{
+	static const uint8_t Expected[] = { 0x00, 0x02, 0x08, 0x09, 0x0B, 0x0C, 0x0D, 0x0E, 0x30, 0x59, 0x5E, 0x5F };
+	uint32_t Count = 0;
+	uint8_t Register;
+	uint8_t i;
+
+	printf("volatile registers\n");
+	for (Register = 0; Register < 128; Register++) {
+		bool bExpected = false;
+		bool bRead;
+		bool bRewritten;
+
+		for (i = 0; i < sizeof(Expected); i++) {
+			bExpected |= Register == Expected[i];
+		}
+
+		Start(false);
+		BK4819_WriteRegister(Register, 0x1234);
+		gSimRegisters[Register] = 0x4321;
+		SIM_BusClearLog();
+		bRead = BK4819_ReadRegister(Register) == 0x4321;
+		Check(bRead == (gSimBusLogLength == 1), "a read went to the bus and did not return the chip value");
+		SIM_BusClearLog();
+		BK4819_WriteRegister(Register, 0x1234);
+		BK4819_WriteRegister(Register, 0x1234);
+		bRewritten = gSimBusLogLength == 2;
+		Check(gSimBusLogLength == 0 || bRewritten, "one of two equal writes was skipped");
+
+		if (bRead != bExpected || bRewritten != bExpected) {
+			printf("  register %02X is %s, read %s, rewritten %s\n", Register, bExpected ? "volatile" : "not volatile", bRead ? "from the chip" : "from the shadow", bRewritten ? "always" : "once");
+			Failures++;
+		}
+		Count += bRead;
+	}
+	printf("  %u of 128 registers always reach the chip\n", Count);
+}
+
+int main(void)
+{
+	Replay();
+	VolatileSet();
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
@@ -0,0 +1,202 @@
+// Reads the simulated EEPROM with the streaming read command (0x054F) the
+// way eeprom-read.py does, in a plain and in an obfuscated session.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "misc.h"
+#include "tests/uartsim.h"
+
+static int Failures;
+static uint32_t Retries;
+
+static void Check(bool bOk, const char *pWhat)
+{
+	if (!bOk) {
+		printf("  FAILED: %s\n", pWhat);
+		Failures++;
+	}
+}
+
+static void Request(uint16_t Offset, uint16_t Size)
+{
+	uint8_t Command[12] = { 0x4F, 0x05, 8, 0 };
+	const uint32_t Timestamp = SIM_TIMESTAMP;
+
+	memcpy(Command + 4, &Offset, 2);
+	memcpy(Command + 6, &Size, 2);
+	memcpy(Command + 8, &Timestamp, 4);
+	SIM_Send(Command, sizeof(Command));
+}
+
+static void Drain(void)
+{
+	uint8_t Reply[256];
+
+	while (SIM_Receive(Reply, 100000.0) >= 0) {
+	}
+}
+
+// Restarts the stream at the first offset not received yet after a bad or
+// missing block. Returns false if the radio refused the read.
+static bool Clone(uint8_t *pOut, uint16_t Offset, uint16_t End)
+{
+	uint16_t Position = Offset;
+	uint16_t Requested = Offset;
+
+	Retries = 0;
+	Request(Position, End - Position);
+
+	while (Position < End) {
+		uint8_t Reply[256];
+		uint16_t BlockOffset;
+		uint16_t Crc;
+		uint8_t Size;
+		int Length;
+
+		Length = SIM_Receive(Reply, 500000.0);
+		if (Length < 0) {
+			Retries++;
+			Requested = Position;
+			Request(Position, End - Position);
+			continue;
+		}
+		if (Length < 12 || Reply[0] != 0x50 || Reply[1] != 0x05) {
+			continue;
+		}
+
+		memcpy(&BlockOffset, Reply + 4, 2);
+		Size = Reply[6];
+		memcpy(&Crc, Reply + 10, 2);
+		if (Size == 0) {
+			return false;
+		}
+
+		if (BlockOffset == Position && Length == 12 + Size && SIM_Crc(Reply + 12, Size) == Crc) {
+			memcpy(pOut + (Position - Offset), Reply + 12, Size);
+			Position += Size;
+		} else if (Requested != Position) {
+			Retries++;
+			Requested = Position;
+			Request(Position, End - Position);
+		}
+	}
+
+	Drain();
+
+	return true;
+}
+
+static void FullClone(const char *pName)
+{
+	static uint8_t Image[EEPROM_SIZE];
+	const double Start = gSimHostUs;
+	double Elapsed;
+
+	memset(Image, 0, sizeof(Image));
+	Check(Clone(Image, 0, EEPROM_SIZE), "the read was refused");
+	Elapsed = gSimHostUs - Start;
+	printf("%-34s %.2f s %5.0f B/s, %u resumed\n", pName, Elapsed / 1e6, EEPROM_SIZE * 1e6 / Elapsed, Retries);
+	Check(memcmp(Image, gSimEeprom, EEPROM_SIZE) == 0, "the image differs");
+}
+
+// Asks for the version while blocks are going out. The reply has to come
+// between two blocks, not inside one.
+static void ReplyDuringStream(void)
+{
+	uint8_t Command[8] = { 0x14, 0x05, 4, 0 };
+	const uint32_t Timestamp = SIM_TIMESTAMP;
+	uint8_t Reply[256];
+	uint16_t Position = 0;
+	uint16_t Remaining = 1;
+	uint16_t BlockOffset;
+	uint16_t Crc;
+	bool bVersion = false;
+	int Length;
+
+	Request(0, 0x800);
+	memcpy(Command + 4, &Timestamp, 4);
+	SIM_Send(Command, sizeof(Command));
+
+	while (Remaining) {
+		Length = SIM_Receive(Reply, 500000.0);
+		if (Length < 0) {
+			break;
+		}
+		if (Reply[0] == 0x15 && Reply[1] == 0x05) {
+			bVersion = true;
+			continue;
+		}
+		memcpy(&BlockOffset, Reply + 4, 2);
+		memcpy(&Remaining, Reply + 8, 2);
+		memcpy(&Crc, Reply + 10, 2);
+		if (BlockOffset != Position || Length != 12 + Reply[6] || SIM_Crc(Reply + 12, Reply[6]) != Crc) {
+			break;
+		}
+		Position += Reply[6];
+	}
+
+	Check(bVersion, "the version reply was lost");
+	Check(Position == 0x800, "a block was lost");
+	Drain();
+}
+
+int main(void)
+{
+	uint8_t Reply[256];
+	uint8_t Tail[128];
+	uint16_t Remaining;
+	uint32_t i;
+	int Length;
+
+	srand(1);
+	for (i = 0; i < EEPROM_SIZE; i++) {
+		gSimEeprom[i] = rand();
+	}
+	SIM_Init();
+
+	Check(SIM_Hello(false), "no reply to 0x0514");
+	FullClone("plain, 4 ms turnaround");
+
+	Check(SIM_Hello(true), "no reply to the obfuscated 0x0514");
+	FullClone("obfuscated, 4 ms turnaround");
+
+	// Damage a data byte of the 21st block, each block being a 148 byte frame
+	gSimCorruptByte = (148 * 20) + 4 + 12 + 40;
+	FullClone("obfuscated, one damaged block");
+	Check(Retries == 1, "the stream was not resumed once");
+	gSimCorruptByte = -1;
+
+	// The stream stops at the end of the EEPROM
+	printf("reading past the end\n");
+	Request(EEPROM_SIZE - 64, 0x100);
+	Length = SIM_Receive(Reply, 500000.0);
+	Check(Length == 12 + 64, "the last block is not 64 bytes");
+	memcpy(&Remaining, Reply + 8, 2);
+	Check(Remaining == 0, "the last block has more to come");
+	Check(SIM_Receive(Reply, 100000.0) < 0, "a block came after the end");
+	Check(Clone(Tail, EEPROM_SIZE - 128, EEPROM_SIZE), "the read was refused");
+	Check(memcmp(Tail, gSimEeprom + EEPROM_SIZE - 128, 128) == 0, "the tail differs");
+
+	printf("reply during a stream\n");
+	ReplyDuringStream();
+
+	printf("locked radio\n");
+	bHasCustomAesKey = true;
+	gIsLocked = true;
+	Request(0, EEPROM_SIZE);
+	Length = SIM_Receive(Reply, 500000.0);
+	Check(Length == 12 && Reply[6] == 0, "the read was not refused");
+	Check(SIM_Receive(Reply, 100000.0) < 0, "a block came after the refusal");
+	bHasCustomAesKey = false;
+	gIsLocked = false;
+
+	Check(gSimOutOfBounds == 0, "the EEPROM was read out of bounds");
+
+	// A chunk on the wire plus the EEPROM read of the next block
+	printf("longest main loop hold %.1f ms\n", gSimLongestPendingUs / 1000.0);
+	Check(gSimLongestPendingUs < 12000.0, "the stream holds the main loop too long");
+
+	return Failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
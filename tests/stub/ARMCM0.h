@@ -0,0 +1,23 @@
+// Host stand-in for the CMSIS device header, only what the sources built by
+// `make host-test` call.
+
+#ifndef TESTS_STUB_ARMCM0_H
+#define TESTS_STUB_ARMCM0_H
+
+#include <stdint.h>
+
+static inline void __disable_irq(void)
+{
+}
+
+static inline void __enable_irq(void)
+{
+}
+
+void NVIC_SystemReset(void);
+
+// tests/bk4819sim.c samples the fast BK4819 bus here, between its stores
+void __NOP(void);
+
+#endif
+
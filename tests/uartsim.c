@@ -0,0 +1,397 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "bsp/dp32g030/dma.h"
+
+// UART_IsCommandAvailable() learns how far the cable has filled
+// UART_DMA_Buffer from channel 0
+static DMA_Channel_t FakeDma;
+
+#undef DMA_CH0
+#define DMA_CH0 (&FakeDma)
+
+#include "app/uart.c"
+#include "tests/uartsim.h"
+
+// 10 bits per byte at 38400 baud
+#define BYTE_US (1000000.0 / 3840.0)
+#define TICK_US 10000.0
+// Bit-banged I2C at roughly 200 kHz, then the page program time
+#define I2C_BYTE_US 45.0
+#define PAGE_PROGRAM_US 5000.0
+
+uint8_t UART_DMA_Buffer[256];
+const uint32_t gDefaultAesKey[4];
+uint32_t gCustomAesKey[4];
+bool bHasCustomAesKey;
+uint32_t gChallenge[4];
+uint8_t gTryCount;
+uint8_t gMR_ChannelAttributes[207];
+MR_Channel_t gMR_Channels[200];
+bool bIsInLockScreen;
+uint8_t gIsLocked;
+FUNCTION_Type_t gCurrentFunction;
+EEPROM_Config_t gEeprom;
+EEPROM_VFO_t gVFO;
+
+uint8_t gSimEeprom[EEPROM_SIZE];
+uint32_t gSimPageWrites;
+uint32_t gSimOutOfBounds;
+uint32_t gSimMaskedWrites;
+double gSimLongestPendingUs;
+double gSimHostUs;
+double gSimHostLatencyUs;
+int32_t gSimCorruptByte;
+
+static const uint8_t HostKey[16] = { 0x16, 0x6C, 0x14, 0xE6, 0x2E, 0x91, 0x0D, 0x40, 0x21, 0x35, 0xD5, 0x40, 0x13, 0x03, 0xE9, 0x80 };
+static bool bHostObfuscated;
+
+static double RadioUs;
+// UART_HandleCommand() runs with interrupts masked on the radio
+static bool bInCommand;
+
+// Radio to host, each byte with the time its stop bit ends
+static uint8_t HostRx[0x10000];
+static double HostRxUs[0x10000];
+static uint32_t HostRxIndex;
+static uint32_t HostRxLength;
+
+// Host to radio, frames written to UART_DMA_Buffer but still on the wire
+static struct {
+	uint16_t Index;
+	double Us;
+} Pending[8];
+static uint8_t PendingCount;
+static uint16_t DmaIndex;
+
+void AES_Encrypt(const void *pKey, const void *pIv, const void *pIn, void *pOut, uint8_t NumBlocks)
+{
+	(void)pKey;
+	(void)pIv;
+	(void)pIn;
+	memset(pOut, 0, NumBlocks * 16U);
+}
+
+uint16_t BK4819_ReadRegister(BK4819_REGISTER_t Register)
+{
+	(void)Register;
+	return 0;
+}
+
+void BOARD_ADC_GetBatteryInfo(uint16_t *pVoltage, uint16_t *pCurrent)
+{
+	*pVoltage = 0;
+	*pCurrent = 0;
+}
+
+void BOARD_EEPROM_Init(void)
+{
+}
+
+uint16_t CRC_Calculate(const void *pBuffer, uint16_t Size)
+{
+	return SIM_Crc(pBuffer, Size);
+}
+
+void EEPROM_Flush(void)
+{
+}
+
+void EEPROM_ReadBuffer(uint16_t Address, void *pBuffer, uint8_t Size)
+{
+	if (Address + Size > EEPROM_SIZE) {
+		gSimOutOfBounds++;
+		memset(pBuffer, 0xFF, Size);
+		return;
+	}
+	memcpy(pBuffer, gSimEeprom + Address, Size);
+	RadioUs += (4 + Size) * I2C_BYTE_US;
+}
+
+// Page writes with the compare-skip of driver/eeprom.c
+void EEPROM_WriteBlock(uint16_t Address, const void *pBuffer, uint16_t Size)
+{
+	const uint8_t *pBytes = (const uint8_t *)pBuffer;
+
+	if (Address + Size > EEPROM_SIZE) {
+		gSimOutOfBounds++;
+		return;
+	}
+	if (bInCommand) {
+		gSimMaskedWrites++;
+	}
+
+	while (Size) {
+		uint16_t Length = EEPROM_PAGE_SIZE - (Address % EEPROM_PAGE_SIZE);
+
+		if (Length > Size) {
+			Length = Size;
+		}
+		RadioUs += (4 + Length) * I2C_BYTE_US;
+		if (memcmp(gSimEeprom + Address, pBytes, Length)) {
+			memcpy(gSimEeprom + Address, pBytes, Length);
+			RadioUs += (3 + Length) * I2C_BYTE_US + PAGE_PROGRAM_US;
+			gSimPageWrites++;
+		}
+		Address += Length;
+		pBytes += Length;
+		Size -= Length;
+	}
+}
+
+void FUNCTION_Select(FUNCTION_Type_t Function)
+{
+	(void)Function;
+}
+
+// Only the backlight, GPIOB is not mapped on the host
+void GPIO_ClearBit(volatile uint32_t *pReg, uint8_t Bit)
+{
+	(void)pReg;
+	(void)Bit;
+}
+
+void NVIC_SystemReset(void)
+{
+}
+
+void RADIO_InitChannelBits(void)
+{
+}
+
+void RADIO_PackChannel(MR_Channel_t *pChannel, uint32_t Frequency, uint32_t Offset, const uint8_t *pData)
+{
+	(void)pChannel;
+	(void)Frequency;
+	(void)Offset;
+	(void)pData;
+}
+
+void UART_Send(const void *pBuffer, uint32_t Size)
+{
+	const uint8_t *pBytes = (const uint8_t *)pBuffer;
+	uint32_t i;
+
+	if (HostRxLength + Size > sizeof(HostRx)) {
+		memmove(HostRx, HostRx + HostRxIndex, HostRxLength - HostRxIndex);
+		memmove(HostRxUs, HostRxUs + HostRxIndex, (HostRxLength - HostRxIndex) * sizeof(HostRxUs[0]));
+		HostRxLength -= HostRxIndex;
+		HostRxIndex = 0;
+	}
+	if (HostRxLength + Size > sizeof(HostRx)) {
+		fprintf(stderr, "uartsim: the host stopped reading\n");
+		exit(EXIT_FAILURE);
+	}
+
+	for (i = 0; i < Size; i++) {
+		RadioUs += BYTE_US;
+		HostRx[HostRxLength] = pBytes[i];
+		if (gSimCorruptByte == 0) {
+			HostRx[HostRxLength] ^= 0x10;
+		}
+		if (gSimCorruptByte >= 0) {
+			gSimCorruptByte--;
+		}
+		HostRxUs[HostRxLength++] = RadioUs;
+	}
+}
+
+uint16_t SIM_Crc(const void *pBuffer, uint16_t Size)
+{
+	const uint8_t *pBytes = (const uint8_t *)pBuffer;
+	uint16_t Crc = 0;
+	uint16_t i;
+	uint8_t j;
+
+	for (i = 0; i < Size; i++) {
+		Crc ^= pBytes[i] << 8;
+		for (j = 0; j < 8; j++) {
+			if (Crc & 0x8000U) {
+				Crc = (Crc << 1) ^ 0x1021U;
+			} else {
+				Crc <<= 1;
+			}
+		}
+	}
+
+	return Crc;
+}
+
+// Passes of the main loop up to Until, each waking on the 10 ms tick unless
+// a read stream keeps it from sleeping. A pass may finish past Until.
+static void RunRadio(double Until)
+{
+	while (RadioUs < Until) {
+		while (PendingCount && Pending[0].Us <= RadioUs) {
+			FakeDma.ST = Pending[0].Index;
+			PendingCount--;
+			memmove(&Pending[0], &Pending[1], PendingCount * sizeof(Pending[0]));
+		}
+
+		double Start;
+
+		if (UART_IsCommandAvailable()) {
+			bInCommand = true;
+			UART_HandleCommand();
+			bInCommand = false;
+		}
+		Start = RadioUs;
+		UART_HandlePending();
+		if (RadioUs - Start > gSimLongestPendingUs) {
+			gSimLongestPendingUs = RadioUs - Start;
+		}
+		if (UART_IsStreaming()) {
+			continue;
+		}
+
+		RadioUs = (floor(RadioUs / TICK_US) + 1.0) * TICK_US;
+	}
+}
+
+void SIM_Init(void)
+{
+	memset(UART_DMA_Buffer, 0, sizeof(UART_DMA_Buffer));
+	memset(&FakeDma, 0, sizeof(FakeDma));
+	gSimPageWrites = 0;
+	gSimOutOfBounds = 0;
+	gSimMaskedWrites = 0;
+	gSimLongestPendingUs = 0;
+	gSimHostUs = 0;
+	gSimHostLatencyUs = 4000;
+	gSimCorruptByte = -1;
+	RadioUs = 0;
+	HostRxIndex = 0;
+	HostRxLength = 0;
+	PendingCount = 0;
+	DmaIndex = 0;
+}
+
+void SIM_Send(const void *pPayload, uint16_t Size)
+{
+	uint8_t Frame[8 + 256];
+	uint16_t Crc;
+	uint16_t i;
+
+	if (Size > 256 || PendingCount == 8) {
+		fprintf(stderr, "uartsim: command too big or too many in flight\n");
+		exit(EXIT_FAILURE);
+	}
+
+	Crc = SIM_Crc(pPayload, Size);
+	Frame[0] = 0xAB;
+	Frame[1] = 0xCD;
+	Frame[2] = Size & 0xFF;
+	Frame[3] = Size >> 8;
+	memcpy(Frame + 4, pPayload, Size);
+	Frame[4 + Size] = Crc & 0xFF;
+	Frame[5 + Size] = Crc >> 8;
+	Frame[6 + Size] = 0xDC;
+	Frame[7 + Size] = 0xBA;
+	if (bHostObfuscated) {
+		for (i = 0; i < Size + 2; i++) {
+			Frame[4 + i] ^= HostKey[i % 16];
+		}
+	}
+
+	for (i = 0; i < Size + 8; i++) {
+		UART_DMA_Buffer[DmaIndex] = Frame[i];
+		DmaIndex = (DmaIndex + 1) % sizeof(UART_DMA_Buffer);
+	}
+
+	gSimHostUs += gSimHostLatencyUs + (Size + 8) * BYTE_US;
+	Pending[PendingCount].Index = DmaIndex;
+	Pending[PendingCount].Us = gSimHostUs;
+	PendingCount++;
+}
+
+// Finds the next whole frame in HostRx. Returns its payload size and the
+// index of its last byte, or -1 if it hasn't all arrived yet.
+static int PeekFrame(uint32_t *pLast)
+{
+	for (;;) {
+		uint16_t Size;
+		uint32_t Tail;
+
+		while (HostRxIndex + 1 < HostRxLength && (HostRx[HostRxIndex] != 0xAB || HostRx[HostRxIndex + 1] != 0xCD)) {
+			HostRxIndex++;
+		}
+		if (HostRxIndex + 4 > HostRxLength) {
+			return -1;
+		}
+
+		Size = HostRx[HostRxIndex + 2] | (HostRx[HostRxIndex + 3] << 8);
+		Tail = HostRxIndex + 4 + Size;
+		if (Tail + 4 > HostRxLength) {
+			return -1;
+		}
+
+		if (HostRx[Tail + 2] == 0xDC && HostRx[Tail + 3] == 0xBA) {
+			const uint8_t Check0 = bHostObfuscated ? HostKey[(Size + 0) % 16] ^ 0xFF : 0xFF;
+			const uint8_t Check1 = bHostObfuscated ? HostKey[(Size + 1) % 16] ^ 0xFF : 0xFF;
+
+			if (HostRx[Tail] == Check0 && HostRx[Tail + 1] == Check1) {
+				*pLast = Tail + 3;
+				return Size;
+			}
+		}
+
+		HostRxIndex++;
+	}
+}
+
+int SIM_Receive(void *pPayload, double TimeoutUs)
+{
+	const double Deadline = gSimHostUs + TimeoutUs;
+	uint8_t *pBytes = (uint8_t *)pPayload;
+
+	for (;;) {
+		uint32_t Last;
+		const int Size = PeekFrame(&Last);
+		int i;
+
+		if (Size >= 0 && HostRxUs[Last] <= Deadline) {
+			if (gSimHostUs < HostRxUs[Last]) {
+				gSimHostUs = HostRxUs[Last];
+			}
+			memcpy(pBytes, HostRx + HostRxIndex + 4, Size);
+			if (bHostObfuscated) {
+				for (i = 0; i < Size; i++) {
+					pBytes[i] ^= HostKey[i % 16];
+				}
+			}
+			HostRxIndex = Last + 1;
+			if (HostRxIndex == HostRxLength) {
+				HostRxIndex = 0;
+				HostRxLength = 0;
+			}
+			return Size;
+		}
+
+		if (gSimHostUs >= Deadline) {
+			return -1;
+		}
+		gSimHostUs = fmin(gSimHostUs + 100.0, Deadline);
+		RunRadio(gSimHostUs);
+	}
+}
+
+bool SIM_Hello(bool bObfuscated)
+{
+	uint8_t Command[8] = { 0x14, 0x05, 4, 0 };
+	uint8_t Reply[256];
+	const uint32_t Timestamp = SIM_TIMESTAMP;
+
+	memcpy(Command + 4, &Timestamp, 4);
+	bHostObfuscated = bObfuscated;
+	SIM_Send(Command, sizeof(Command));
+
+	while (SIM_Receive(Reply, 1000000.0) >= 0) {
+		if (Reply[0] == 0x15 && Reply[1] == 0x05) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
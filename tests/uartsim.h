@@ -0,0 +1,42 @@
+// Host model of a 38400 baud cable between a programming tool and the UART
+// handler in app/uart.c, with the EEPROM kept in RAM. The host and the radio
+// have their own clocks. The radio main loop only runs when the host waits
+// on it, and wakes on the 10 ms tick while it has nothing to do.
+
+#ifndef TESTS_UARTSIM_H
+#define TESTS_UARTSIM_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "driver/eeprom.h"
+
+#define SIM_TIMESTAMP 0x12345678U
+
+extern uint8_t gSimEeprom[EEPROM_SIZE];
+// Pages actually programmed and writes that ran past the end of the EEPROM
+extern uint32_t gSimPageWrites;
+extern uint32_t gSimOutOfBounds;
+// Writes made from UART_HandleCommand(), which the radio runs with
+// interrupts masked, and the longest UART_HandlePending() call
+extern uint32_t gSimMaskedWrites;
+extern double gSimLongestPendingUs;
+// Host time in microseconds, and the time the host takes to act on a reply
+extern double gSimHostUs;
+extern double gSimHostLatencyUs;
+// Radio to host bytes to let through before damaging one, or -1
+extern int32_t gSimCorruptByte;
+
+void SIM_Init(void);
+// Starts a session with 0x0514. An obfuscated session also obfuscates every
+// later command and expects obfuscated replies.
+bool SIM_Hello(bool bObfuscated);
+// Waits gSimHostLatencyUs, then sends a command. pPayload starts with the
+// command ID and size.
+void SIM_Send(const void *pPayload, uint16_t Size);
+// Returns the size of the next reply payload, or -1 if nothing arrived
+// within TimeoutUs. Frames with a bad footer are skipped.
+int SIM_Receive(void *pPayload, double TimeoutUs);
+uint16_t SIM_Crc(const void *pBuffer, uint16_t Size);
+
+#endif
+
@@ -0,0 +1,160 @@
+#include <stdbool.h>
+#include "ARMCM0.h"
+#include "timer.h"
+
+enum {
+	TIMER_STATE_STOPPED = 0U,
+	TIMER_STATE_RUNNING,
+	TIMER_STATE_HELD,
+};
+
+typedef struct {
+	uint32_t Expiry;
+	// Ticks left while the current mode holds the timer
+	uint16_t Held;
+	// Slot list links, stored as ID + 1 so that 0 ends the list
+	uint8_t Next;
+	uint8_t Prev;
+	uint8_t State;
+} Timer_t;
+
+static Timer_t gTimers[TIMER_COUNT];
+static uint8_t gWheel[TIMER_WHEEL_SIZE];
+static uint32_t gNow;
+static uint8_t gModeBit = 1U;
+
+// Everything below the public functions expects interrupts to be off, or to
+// run from the SysTick handler itself. The public functions restore PRIMASK
+// rather than clear it, UART commands reach them with interrupts masked.
+
+static void Link(uint8_t Id)
+{
+	Timer_t *pTimer = &gTimers[Id];
+	uint8_t *pHead = &gWheel[pTimer->Expiry & (TIMER_WHEEL_SIZE - 1)];
+
+	pTimer->Prev = 0;
+	pTimer->Next = *pHead;
+	if (*pHead) {
+		gTimers[*pHead - 1].Prev = Id + 1;
+	}
+	*pHead = Id + 1;
+}
+
+static void Unlink(uint8_t Id)
+{
+	Timer_t *pTimer = &gTimers[Id];
+
+	if (pTimer->Prev) {
+		gTimers[pTimer->Prev - 1].Next = pTimer->Next;
+	} else {
+		gWheel[pTimer->Expiry & (TIMER_WHEEL_SIZE - 1)] = pTimer->Next;
+	}
+	if (pTimer->Next) {
+		gTimers[pTimer->Next - 1].Prev = pTimer->Prev;
+	}
+}
+
+static void Arm(uint8_t Id, uint16_t Ticks)
+{
+	Timer_t *pTimer = &gTimers[Id];
+
+	if (gTimerConfig[Id].ModeMask & gModeBit) {
+		pTimer->Expiry = gNow + Ticks;
+		pTimer->State = TIMER_STATE_RUNNING;
+		Link(Id);
+	} else {
+		pTimer->Held = Ticks;
+		pTimer->State = TIMER_STATE_HELD;
+	}
+}
+
+static void Cancel(uint8_t Id)
+{
+	if (gTimers[Id].State == TIMER_STATE_RUNNING) {
+		Unlink(Id);
+	}
+	gTimers[Id].State = TIMER_STATE_STOPPED;
+}
+
+void TIMER_Start(uint8_t Id, uint16_t Ticks)
+{
+	const uint32_t Primask = __get_PRIMASK();
+
+	__disable_irq();
+	Cancel(Id);
+	if (Ticks > 0) {
+		Arm(Id, Ticks);
+	}
+	__set_PRIMASK(Primask);
+}
+
+void TIMER_Stop(uint8_t Id)
+{
+	const uint32_t Primask = __get_PRIMASK();
+
+	__disable_irq();
+	Cancel(Id);
+	__set_PRIMASK(Primask);
+}
+
+void TIMER_SetMode(uint8_t Mode)
+{
+	const uint32_t Primask = __get_PRIMASK();
+	uint8_t Id;
+
+	__disable_irq();
+	gModeBit = 1U << Mode;
+	for (Id = 0; Id < TIMER_COUNT; Id++) {
+		Timer_t *pTimer = &gTimers[Id];
+		const bool bCounts = (gTimerConfig[Id].ModeMask & gModeBit) != 0;
+
+		if (pTimer->State == TIMER_STATE_RUNNING && !bCounts) {
+			Unlink(Id);
+			pTimer->Held = pTimer->Expiry - gNow;
+			pTimer->State = TIMER_STATE_HELD;
+		} else if (pTimer->State == TIMER_STATE_HELD && bCounts) {
+			Arm(Id, pTimer->Held);
+		}
+	}
+	__set_PRIMASK(Primask);
+}
+
+void TIMER_Tick(void)
+{
+	uint8_t Index;
+
+	gNow++;
+
+	// Only the slot for this tick is visited
+	Index = gWheel[gNow & (TIMER_WHEEL_SIZE - 1)];
+	while (Index) {
+		const uint8_t Id = Index - 1;
+		Timer_t *pTimer = &gTimers[Id];
+
+		Index = pTimer->Next;
+		if (pTimer->Expiry != gNow) {
+			continue;
+		}
+		Unlink(Id);
+		pTimer->State = TIMER_STATE_STOPPED;
+		if (gTimerConfig[Id].Period) {
+			Arm(Id, gTimerConfig[Id].Period);
+		}
+		gTimerConfig[Id].pHandler();
+	}
+}
+
+uint16_t TIMER_GetNextExpiry(void)
+{
+	uint32_t Next = 0xFFFFU;
+	uint8_t Id;
+
+	for (Id = 0; Id < TIMER_COUNT; Id++) {
+		if (gTimers[Id].State == TIMER_STATE_RUNNING && gTimers[Id].Expiry - gNow < Next) {
+			Next = gTimers[Id].Expiry - gNow;
+		}
+	}
+
+	return Next;
+}
+
@@ -0,0 +1,43 @@
+#ifndef TIMER_H
+#define TIMER_H
+
+#include <stdint.h>
+
+// Slots in the wheel, must be a power of two. Timers that hash to the
+// same slot are told apart by their absolute expiry tick.
+#define TIMER_WHEEL_SIZE 16U
+
+enum {
+	TIMER_SLICE_40MS = 0U,
+	TIMER_SLICE_500MS,
+	TIMER_TX_TIMEOUT,
+	TIMER_POWER_SAVE,
+	TIMER_BATTERY_SAVE,
+	TIMER_DUAL_WATCH,
+	TIMER_SCAN_PAUSE,
+	TIMER_TAIL_NOTE,
+	TIMER_FOUND_CTCSS,
+	TIMER_FOUND_CDCSS,
+	TIMER_COUNT,
+};
+
+typedef struct {
+	// Called from the SysTick handler on expiry, must not start or stop timers
+	void (*pHandler)(void);
+	// Reload in ticks for periodic timers, 0 for one-shot
+	uint16_t Period;
+	// Modes in which the timer counts down, it is held otherwise
+	uint8_t ModeMask;
+} TIMER_Config_t;
+
+// Provided by the owner of the timer IDs above
+extern const TIMER_Config_t gTimerConfig[TIMER_COUNT];
+
+void TIMER_Start(uint8_t Id, uint16_t Ticks);
+void TIMER_Stop(uint8_t Id);
+void TIMER_SetMode(uint8_t Mode);
+void TIMER_Tick(void);
+uint16_t TIMER_GetNextExpiry(void);
+
+#endif
+
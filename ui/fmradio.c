@@ -17,7 +17,7 @@
 #include <string.h>
 #include "app/fm.h"
 #include "driver/st7565.h"
-#include "external/printf/printf.h"
+#include "helper/format.h"
 #include "misc.h"
 #include "settings.h"
 #include "ui/fmradio.h"
@@ -47,7 +47,7 @@ void UI_DisplayFM(void)
 			if (!gFM.IsMrMode) {
 				for (i = 0; i < 20; i++) {
 					if (gEeprom.FM_FrequencyPlaying == gFM_Channels[i]) {
-						sprintf(String, "VFO(CH%02u)", i + 1);
+						FORMAT_Char(FORMAT_Unsigned(FORMAT_String(String, "VFO(CH"), i + 1, 2), ')');
 						break;
 					}
 				}
@@ -55,13 +55,13 @@ void UI_DisplayFM(void)
 					strcpy(String, "VFO");
 				}
 			} else {
-				sprintf(String, "MR(CH%02u)", gFM.SelectedChannel + 1);
+				FORMAT_Char(FORMAT_Unsigned(FORMAT_String(String, "MR(CH"), gFM.SelectedChannel + 1, 2), ')');
 			}
 		} else {
 			if (!gFM_AutoScan) {
 				strcpy(String, "M-SCAN");
 			} else {
-				sprintf(String, "A-SCAN(%u)", gFM_ChannelPosition + 1);
+				FORMAT_Char(FORMAT_Unsigned(FORMAT_String(String, "A-SCAN("), gFM_ChannelPosition + 1, 0), ')');
 			}
 		}
 	}
@@ -81,7 +81,7 @@ void UI_DisplayFM(void)
 		ST7565_BlitFullScreen();
 		return;
 	} else {
-		sprintf(String, "CH-%02u", gFM.SelectedChannel + 1);
+		FORMAT_Unsigned(FORMAT_String(String, "CH-"), gFM.SelectedChannel + 1, 2);
 	}
 
 	UI_PrintString(String, 0, 127, 4, 10, true);
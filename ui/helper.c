@@ -16,17 +16,29 @@
 
 #include <string.h>
 #include "driver/st7565.h"
-#include "external/printf/printf.h"
 #include "font.h"
+#include "helper/format.h"
 #include "ui/helper.h"
 #include "ui/inputbox.h"
 
+static void DrawGlyph(uint8_t *pFb0, uint8_t *pFb1, const uint8_t *pGlyph, uint8_t Width)
+{
+	uint8_t i;
+
+	for (i = 0; i < Width; i++) {
+		const uint8_t *pColumn = gFontColumns[pGlyph[i]];
+
+		pFb0[i] = pColumn[0];
+		pFb1[i] = pColumn[1];
+	}
+}
+
 void UI_GenerateChannelString(char *pString, uint8_t Channel)
 {
 	uint8_t i;
 
 	if (gInputBoxIndex == 0) {
-		sprintf(pString, "CH-%02u", Channel + 1);
+		FORMAT_Unsigned(FORMAT_String(pString, "CH-"), Channel + 1, 2);
 		return;
 	}
 
@@ -60,12 +72,12 @@ void UI_GenerateChannelStringEx(char *pString, bool bShowPrefix, uint8_t Channel
 	}
 
 	if (bShowPrefix) {
-		sprintf(pString, "CH-%03u", ChannelNumber + 1);
+		FORMAT_Unsigned(FORMAT_String(pString, "CH-"), ChannelNumber + 1, 3);
 	} else {
 		if (ChannelNumber == 0xFF) {
 			strcpy(pString, "NULL");
 		} else {
-			sprintf(pString, "%03u", ChannelNumber + 1);
+			FORMAT_Unsigned(pString, ChannelNumber + 1, 3);
 		}
 	}
 }
@@ -80,10 +92,10 @@ void UI_PrintString(const char *pString, uint8_t Start, uint8_t End, uint8_t Lin
 	}
 	for (i = 0; i < Length; i++) {
 		if (pString[i] >= ' ' && pString[i] < 0x7F) {
-			uint8_t Index = pString[i] - ' ';
-			memcpy(gFrameBuffer[Line + 0] + (i * Width) + Start, &gFontBig[Index][0], 8);
-			//memcpy(gFrameBuffer[Line + 1] + (i * Width) + Start, &gFontBig[Index][8], 8);
-			memcpy(gFrameBuffer[Line + 1] + (i * Width) + Start, &gFontBig[Index][8], 7);
+			uint8_t *pFb0 = gFrameBuffer[Line + 0] + (i * Width) + Start;
+
+			DrawGlyph(pFb0, pFb0 + 128, gFontBig[pString[i] - ' '], 7);
+			pFb0[7] = 0x00;
 		}
 	}
 }
@@ -103,8 +115,7 @@ void UI_DisplayFrequency(const char *pDigits, uint8_t X, uint8_t Y, bool bDispla
 
 		if (bDisplayLeadingZero || bCanDisplay || Digit) {
 			bCanDisplay = true;
-			memcpy(pFb0 + (i * 13), gFontBigDigits[Digit] +  0, 13);
-			memcpy(pFb1 + (i * 13), gFontBigDigits[Digit] + 13, 13);
+			DrawGlyph(pFb0 + (i * 13), pFb1 + (i * 13), gFontBigDigits[Digit], 13);
 		} else if (bFlag) {
 			pFb1 -= 6;
 			pFb0 -= 6;
@@ -118,8 +129,7 @@ void UI_DisplayFrequency(const char *pDigits, uint8_t X, uint8_t Y, bool bDispla
 	for (i = 0; i < 3; i++) {
 		const uint8_t Digit = pDigits[i + 3];
 
-		memcpy(pFb0 + (i * 13) + 42, gFontBigDigits[Digit] +  0, 13);
-		memcpy(pFb1 + (i * 13) + 42, gFontBigDigits[Digit] + 13, 13);
+		DrawGlyph(pFb0 + (i * 13) + 42, pFb1 + (i * 13) + 42, gFontBigDigits[Digit], 13);
 	}
 }
 
@@ -58,8 +58,19 @@ void UI_DisplayLock(void)
 	memset(gInputBox, 10, sizeof(gInputBox));
 
 	while (1) {
-		while (!SCHEDULER_CheckTask(TASK_SLEEP)) {
+		while (!SCHEDULER_CheckTask(TASK_CHECK_KEYS)) {
+			// Only the keys are serviced here. Drop the other tasks, or
+			// SCHEDULER_Sleep() never gets to WFI.
+			SCHEDULER_ClearTask(TASK_UPDATE_SCREEN | TASK_CHECK_RADIO_INTERRUPTS | TASK_SCANNER | TASK_FM_RADIO);
+#if defined(ENABLE_UART)
+			if (UART_IsStreaming()) {
+				UART_HandlePending();
+				continue;
+			}
+#endif
+			SCHEDULER_Sleep();
 		}
+		SCHEDULER_ClearTask(TASK_CHECK_KEYS);
 		// TODO: Original code doesn't do the below, but is needed for proper key debounce.
 		Key = KEYBOARD_Poll();
 		if (gKeyReading0 == Key) {
@@ -109,6 +120,7 @@ void UI_DisplayLock(void)
 			UART_HandleCommand();
 			__enable_irq();
 		}
+		UART_HandlePending();
 #endif
 
 		if (gUpdateDisplay) {
@@ -18,8 +18,8 @@
 #include "app/dtmf.h"
 #include "bitmaps.h"
 #include "driver/st7565.h"
-#include "external/printf/printf.h"
 #include "functions.h"
+#include "helper/format.h"
 #if defined(ENABLE_MDC1200)
 #include "mdc1200.h"
 #endif
@@ -86,9 +86,9 @@ void UI_DisplayMain(void)
 						}
 					} else if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED) {
 						if (DTMF_FindContact(gDTMF_Caller, Contact)) {
-							sprintf(String, "CALL:%s", Contact);
+							FORMAT_String(FORMAT_String(String, "CALL:"), Contact);
 						} else {
-							sprintf(String, "CALL:%s", gDTMF_Caller);
+							FORMAT_String(FORMAT_String(String, "CALL:"), gDTMF_Caller);
 						}
 					} else if (gDTMF_IsTx) {
 						if (gDTMF_State == DTMF_STATE_TX_SUCC) {
@@ -98,7 +98,7 @@ void UI_DisplayMain(void)
 						}
 					}
 				} else {
-					sprintf(String, ">%s", gDTMF_InputBox);
+					FORMAT_String(FORMAT_Char(String, '>'), gDTMF_InputBox);
 				}
 				UI_PrintString(String, 2, 127, i * 3, 8, false);
 
@@ -108,18 +108,18 @@ void UI_DisplayMain(void)
 				if (!gDTMF_InputMode) {
 					if (gDTMF_CallState == DTMF_CALL_STATE_CALL_OUT) {
 						if (DTMF_FindContact(gDTMF_String, Contact)) {
-							sprintf(String, ">%s", Contact);
+							FORMAT_String(FORMAT_Char(String, '>'), Contact);
 						} else {
-							sprintf(String, ">%s", gDTMF_String);
+							FORMAT_String(FORMAT_Char(String, '>'), gDTMF_String);
 						}
 					} else if (gDTMF_CallState == DTMF_CALL_STATE_RECEIVED) {
 						if (DTMF_FindContact(gDTMF_Callee, Contact)) {
-							sprintf(String, ">%s", Contact);
+							FORMAT_String(FORMAT_Char(String, '>'), Contact);
 						} else {
-							sprintf(String, ">%s", gDTMF_Callee);
+							FORMAT_String(FORMAT_Char(String, '>'), gDTMF_Callee);
 						}
 					} else if (gDTMF_IsTx) {
-						sprintf(String, ">%s", gDTMF_String);
+						FORMAT_String(FORMAT_Char(String, '>'), gDTMF_String);
 					}
 				}
 				UI_PrintString(String, 2, 127, 2 + (i * 3), 8, false);
@@ -127,7 +127,7 @@ void UI_DisplayMain(void)
 			}
 #if defined(ENABLE_MDC1200)
 			else if (mdc1200_rx_ready_tick_500ms > 0) {
-				sprintf(String, "MDC1200 ID %04x", mdc1200_unit_id);
+				FORMAT_Hex(FORMAT_String(String, "MDC1200 ID "), mdc1200_unit_id, 4);
 				UI_PrintString(String, 2, 127, i * 3, 8, false);
 				continue;
 			}
@@ -244,14 +244,16 @@ void UI_DisplayMain(void)
 					}
 					UI_DisplaySmallDigits(2, String + 6, 112, Line + 1);
 				} else if (gEeprom.CHANNEL_DISPLAY_MODE == MDF_CHANNEL) {
-					sprintf(String, "CH-%03u", gEeprom.ScreenChannel[i] + 1);
+					FORMAT_Unsigned(FORMAT_String(String, "CH-"), gEeprom.ScreenChannel[i] + 1, 3);
 					UI_PrintString(String, 31, 112, i * 4, 8, true);
 				} else if (gEeprom.CHANNEL_DISPLAY_MODE == MDF_NAME) {
-					if(gVFO.Info[i].Name[0] == 0 || gVFO.Info[i].Name[0] == 0xFF) {
-						sprintf(String, "CH-%03u", gEeprom.ScreenChannel[i] + 1);
+					const char *pName = RADIO_GetChannelName(i);
+
+					if(pName[0] == 0 || pName[0] == 0xFF) {
+						FORMAT_Unsigned(FORMAT_String(String, "CH-"), gEeprom.ScreenChannel[i] + 1, 3);
 						UI_PrintString(String, 31, 112, i * 4, 8, true);
 					} else {
-						UI_PrintString(gVFO.Info[i].Name, 31, 112, i * 4, 8, true);
+						UI_PrintString(pName, 31, 112, i * 4, 8, true);
 					}
 				}
 			}
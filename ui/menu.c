@@ -19,9 +19,9 @@
 #include "bitmaps.h"
 #include "dcs.h"
 #include "driver/st7565.h"
-#include "external/printf/printf.h"
 #include "frequencies.h"
 #include "helper/battery.h"
+#include "helper/format.h"
 #include "misc.h"
 #include "settings.h"
 #include "ui/helper.h"
@@ -52,6 +52,7 @@ static const MENU_Item_t MenuList[56] = {
 	{ "TOT", MENU_TOT },
 	// { "VOICE", MENU_VOICE },
 	{ "SC-REV", MENU_SC_REV },
+	{ "SC-ADP", MENU_SC_ADP },
 	{ "MDF", MENU_MDF },
 	{ "AUTOLK", MENU_AUTOLK },
 	{ "S-ADD1", MENU_S_ADD1 },
@@ -219,20 +220,17 @@ void UI_DisplayMenu(void)
 	NUMBER_ToDigits(gMenuCursor + 1, String);
 	UI_DisplaySmallDigits(2, String + 6, 33, 6);
 
-	uint32_t kHz;
 	char Contact[16];
 	uint32_t Vol;
 
 	switch (gMenuCursor) {
 	case MENU_SQL:
 	case MENU_MIC:
-		sprintf(String, "%u", gSubMenuSelection);
+		FORMAT_Unsigned(String, gSubMenuSelection, 0);
 		break;
 
 	case MENU_STEP:
-		kHz = gSubMenu_Step[gSubMenuSelection] / 100;
-		uint8_t Hz = gSubMenu_Step[gSubMenuSelection] % 100;
-		sprintf(String, "%u.%02ukHz", kHz, Hz);
+		FORMAT_String(FORMAT_Fixed(String, gSubMenu_Step[gSubMenuSelection], 2), "kHz");
 		break;
 
 	case MENU_TXP:
@@ -244,9 +242,9 @@ void UI_DisplayMenu(void)
 		if (gSubMenuSelection == 0) {
 			strcpy(String, "OFF");
 		} else if (gSubMenuSelection < 105) {
-			sprintf(String, "D%03oN", DCS_Options[gSubMenuSelection - 1]);
+			FORMAT_Char(FORMAT_Octal(FORMAT_Char(String, 'D'), DCS_Options[gSubMenuSelection - 1], 3), 'N');
 		} else {
-			sprintf(String, "D%03oI", DCS_Options[gSubMenuSelection - 105]);
+			FORMAT_Char(FORMAT_Octal(FORMAT_Char(String, 'D'), DCS_Options[gSubMenuSelection - 105], 3), 'I');
 		}
 		break;
 
@@ -255,9 +253,7 @@ void UI_DisplayMenu(void)
 		if (gSubMenuSelection == 0) {
 			strcpy(String, "OFF");
 		} else {
-			uint8_t Hz = CTCSS_Options[gSubMenuSelection - 1] / 10;
-			uint8_t mHz = CTCSS_Options[gSubMenuSelection - 1] % 10;
-			sprintf(String, "%u.%01uHz", Hz, mHz);
+			FORMAT_String(FORMAT_Fixed(String, CTCSS_Options[gSubMenuSelection - 1], 1), "Hz");
 		}
 		break;
 
@@ -277,9 +273,7 @@ void UI_DisplayMenu(void)
 			String[i] = (gInputBox[i] == 10) ? '-' : gInputBox[i] + '0';
 			i++;
 		}
-		uint16_t MHz = gSubMenuSelection / 100000;
-		kHz = gSubMenuSelection % 100000;
-		sprintf(String, "%u.%05u", MHz, kHz);
+		FORMAT_Fixed(String, gSubMenuSelection, 5);
 		break;
 
 	case MENU_W_N:
@@ -290,7 +284,7 @@ void UI_DisplayMenu(void)
 		if (gSubMenuSelection == 0) {
 			strcpy(String, "OFF");
 		} else {
-			sprintf(String, "%u", gSubMenuSelection * 2);
+			FORMAT_Unsigned(String, gSubMenuSelection * 2, 0);
 		}
 		break;
 
@@ -299,6 +293,7 @@ void UI_DisplayMenu(void)
 		break;
 
 	case MENU_BCL:
+	case MENU_SC_ADP:
 	case MENU_AUTOLK:
 	case MENU_S_ADD1:
 	case MENU_S_ADD2:
@@ -329,7 +324,7 @@ void UI_DisplayMenu(void)
 		if (gSubMenuSelection == 0) {
 			strcpy(String, "OFF");
 		} else {
-			sprintf(String, "%umin", gSubMenuSelection);
+			FORMAT_String(FORMAT_Unsigned(String, gSubMenuSelection, 0), "min");
 		}
 		break;
 
@@ -345,12 +340,12 @@ void UI_DisplayMenu(void)
 		if (gSubMenuSelection == 0) {
 			strcpy(String, "OFF");
 		} else {
-			sprintf(String, "%u*100ms", gSubMenuSelection);
+			FORMAT_String(FORMAT_Unsigned(String, gSubMenuSelection, 0), "*100ms");
 		}
 		break;
 
 	case MENU_S_LIST:
-		sprintf(String, "LIST%u", gSubMenuSelection);
+		FORMAT_Unsigned(FORMAT_String(String, "LIST"), gSubMenuSelection, 0);
 		break;
 
 	case MENU_ANI_ID:
@@ -370,16 +365,16 @@ void UI_DisplayMenu(void)
 		break;
 
 	case MENU_D_HOLD:
-		sprintf(String, "%us", gSubMenuSelection);
+		FORMAT_Char(FORMAT_Unsigned(String, gSubMenuSelection, 0), 's');
 		break;
 
 	case MENU_D_PRE:
-		sprintf(String, "%u*10ms", gSubMenuSelection);
+		FORMAT_String(FORMAT_Unsigned(String, gSubMenuSelection, 0), "*10ms");
 		break;
 
 #if defined(ENABLE_MDC1200)
 	case MENU_MDC_ID:
-		sprintf(String, "%04x", gSubMenuSelection);
+		FORMAT_Hex(String, gSubMenuSelection, 4);
 		break;
 
 	case MENU_MDCMOD:
@@ -412,7 +407,7 @@ void UI_DisplayMenu(void)
 
 	case MENU_BATCAL:
 		Vol = gBatteryVoltageAverage * gBatteryCalibration[3] / gSubMenuSelection;
-		sprintf(String, "%u.%02uV-%#4u", Vol / 100, Vol % 100, gSubMenuSelection);
+		FORMAT_Aligned(FORMAT_String(FORMAT_Fixed(String, Vol, 2), "V-"), gSubMenuSelection, 4);
 		break;
 	}
 	UI_PrintString(String, 50, 127, 2, 8, true);
@@ -458,7 +453,7 @@ void UI_DisplayMenu(void)
 		if (gIsDtmfContactValid) {
 			Contact[11] = 0;
 			memcpy(&gDTMF_ID, Contact + 8, 4);
-			sprintf(String, "ID:%s", Contact + 8);
+			FORMAT_String(FORMAT_String(String, "ID:"), Contact + 8);
 			UI_PrintString(String, 50, 127, 4, 8, true);
 		}
 		break;
@@ -488,11 +483,11 @@ void UI_DisplayMenu(void)
 		} else {
 			UI_PrintString(String, 50, 127, 0, 8, true);
 			if (IS_MR_CHANNEL(gEeprom.SCANLIST_PRIORITY_CH1[i])) {
-				sprintf(String, "PRI1:%u", gEeprom.SCANLIST_PRIORITY_CH1[i] + 1);
+				FORMAT_Unsigned(FORMAT_String(String, "PRI1:"), gEeprom.SCANLIST_PRIORITY_CH1[i] + 1, 0);
 				UI_PrintString(String, 50, 127, 2, 8, true);
 			}
 			if (IS_MR_CHANNEL(gEeprom.SCANLIST_PRIORITY_CH2[i])) {
-				sprintf(String, "PRI2:%u", gEeprom.SCANLIST_PRIORITY_CH2[i] + 1);
+				FORMAT_Unsigned(FORMAT_String(String, "PRI2:"), gEeprom.SCANLIST_PRIORITY_CH2[i] + 1, 0);
 				UI_PrintString(String, 50, 127, 4, 8, true);
 			}
 		}
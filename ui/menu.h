@@ -48,6 +48,7 @@ enum MENU_ID_t {
 	MENU_TOT,
 	// MENU_VOICE,
 	MENU_SC_REV,
+	MENU_SC_ADP,
 	MENU_MDF,
 	MENU_AUTOLK,
 	MENU_S_ADD1,
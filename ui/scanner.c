@@ -19,7 +19,7 @@
 #include "app/scanner.h"
 #include "dcs.h"
 #include "driver/st7565.h"
-#include "external/printf/printf.h"
+#include "helper/format.h"
 #include "misc.h"
 #include "ui/helper.h"
 #include "ui/scanner.h"
@@ -34,9 +34,7 @@ void UI_DisplayScanner(void)
 	memset(String, 0, sizeof(String));
 
 	if (gScanSingleFrequency || (gScanCssState != SCAN_CSS_STATE_OFF && gScanCssState != SCAN_CSS_STATE_FAILED)) {
-		uint16_t MHz = gScanFrequency / 100000;
-		uint32_t kHz = gScanFrequency % 100000;
-		sprintf(String, "FREQ:%u.%05u", MHz, kHz);
+		FORMAT_Fixed(FORMAT_String(String, "FREQ:"), gScanFrequency, 5);
 	} else {
 		strcpy(String, "FREQ:***.*****");
 	}
@@ -46,11 +44,9 @@ void UI_DisplayScanner(void)
 	if (gScanCssState < SCAN_CSS_STATE_FOUND || !gScanUseCssResult) {
 		strcpy(String, "CTC:***.*");
 	} else if (gScanCssResultType == CODE_TYPE_CONTINUOUS_TONE) {
-		uint8_t Hz = CTCSS_Options[gScanCssResultCode] / 10;
-		uint8_t mHz = CTCSS_Options[gScanCssResultCode] % 10;
-		sprintf(String, "CTC:%u.%01uHz", Hz, mHz);
+		FORMAT_String(FORMAT_Fixed(FORMAT_String(String, "CTC:"), CTCSS_Options[gScanCssResultCode], 1), "Hz");
 	} else {
-		sprintf(String, "DCS:D%03oN", DCS_Options[gScanCssResultCode]);
+		FORMAT_Char(FORMAT_Octal(FORMAT_String(String, "DCS:D"), DCS_Options[gScanCssResultCode], 3), 'N');
 	}
 	UI_PrintString(String, 2, 127, 3, 8, false);
 	memset(String, 0, sizeof(String));
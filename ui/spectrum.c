@@ -0,0 +1,80 @@
+#include <string.h>
+#include "app/spectrum.h"
+#include "driver/st7565.h"
+#include "frequencies.h"
+#include "helper/format.h"
+#include "ui/helper.h"
+#include "ui/spectrum.h"
+
+// Bars occupy lines 2 to 4 with 3 dB per pixel, from -130 dBm upwards
+#define GRAPH_LINE   2U
+#define GRAPH_HEIGHT 24U
+#define GRAPH_FLOOR  30U
+#define GRAPH_SCALE  3U
+
+static uint8_t GetHeight(uint8_t Rssi)
+{
+	if (Rssi <= GRAPH_FLOOR) {
+		return 0;
+	}
+	Rssi = (Rssi - GRAPH_FLOOR) / GRAPH_SCALE;
+	if (Rssi > GRAPH_HEIGHT) {
+		return GRAPH_HEIGHT;
+	}
+
+	return Rssi;
+}
+
+static void DrawColumn(uint8_t X, uint8_t Height, uint8_t Peak)
+{
+	uint8_t i;
+
+	for (i = 0; i < GRAPH_HEIGHT / 8; i++) {
+		uint8_t *pByte = &gFrameBuffer[GRAPH_LINE + (GRAPH_HEIGHT / 8) - 1 - i][X];
+
+		// Bit 7 is the bottom row of each display line
+		if (Height >= 8) {
+			*pByte = 0xFF;
+			Height -= 8;
+		} else {
+			*pByte = (uint8_t)(0xFF << (8 - Height));
+			Height = 0;
+		}
+	}
+	if (Peak > 0) {
+		Peak--;
+		gFrameBuffer[GRAPH_LINE + (GRAPH_HEIGHT / 8) - 1 - (Peak / 8)][X] |= 0x80U >> (Peak % 8);
+	}
+}
+
+void UI_DisplaySpectrum(void)
+{
+	const uint16_t Step = StepFrequencyTable[gSpectrumStepSetting];
+	const uint8_t Width = SPECTRUM_MAX_POINTS / gSpectrumPoints;
+	char String[17];
+	char *pString;
+	uint8_t i, j;
+
+	memset(gFrameBuffer, 0, sizeof(gFrameBuffer));
+
+	pString = FORMAT_Fixed(String, gSpectrumCentre / 100, 3);
+	pString = FORMAT_Char(pString, ' ');
+	FORMAT_Char(FORMAT_Fixed(pString, Step, 2), 'K');
+	UI_PrintString(String, 0, 127, 0, 8, true);
+
+	for (i = 0; i < gSpectrumPoints; i++) {
+		const uint8_t Height = GetHeight(gSpectrumRssi[i]);
+		const uint8_t Peak = GetHeight(gSpectrumPeak[i]);
+
+		for (j = 0; j < Width; j++) {
+			DrawColumn((i * Width) + j, Height, Peak);
+		}
+	}
+
+	pString = FORMAT_String(FORMAT_Unsigned(String, gSpectrumRate, 0), "/s ");
+	FORMAT_Char(FORMAT_Unsigned(pString, (gSpectrumPoints * Step) / 100U, 0), 'K');
+	UI_PrintString(String, 0, 127, 5, 8, true);
+
+	ST7565_BlitFullScreen();
+}
+
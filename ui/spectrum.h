@@ -0,0 +1,7 @@
+#ifndef UI_SPECTRUM_H
+#define UI_SPECTRUM_H
+
+void UI_DisplaySpectrum(void);
+
+#endif
+
@@ -26,6 +26,9 @@
 #include "ui/main.h"
 #include "ui/menu.h"
 #include "ui/scanner.h"
+#if defined(ENABLE_SPECTRUM)
+#include "ui/spectrum.h"
+#endif
 #include "ui/ui.h"
 
 GUI_DisplayType_t gScreenToDisplay;
@@ -52,6 +55,11 @@ void GUI_DisplayScreen(void)
 	case DISPLAY_SCANNER:
 		UI_DisplayScanner();
 		break;
+#if defined(ENABLE_SPECTRUM)
+	case DISPLAY_SPECTRUM:
+		UI_DisplaySpectrum();
+		break;
+#endif
 	default:
 		break;
 	}